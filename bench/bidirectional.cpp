@@ -0,0 +1,74 @@
+// C++ Standard Library
+#include <iostream>
+
+// CppCon
+#include <cppcon/bidirectional_search.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/a3/context.h>
+#include <cppcon/demo/a3/graph.h>
+#include <cppcon/demo/a5/context.h>
+#include <cppcon/demo/a5/graph.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v6/context.h>
+#include <cppcon/demo/v6/graph.h>
+
+using namespace cppcon;
+
+template<typename C, SearchGraph G>
+void report(const char* name, const G& graph, const std::vector<bench::Query>& queries)
+{
+  C ctx;
+  std::size_t solved = 0;
+  std::size_t settled = 0;
+  const bench::Stopwatch stopwatch;
+  for (const auto& q : queries)
+  {
+    ctx.set_goal(q.goal);
+    solved += search(ctx, graph, q.start);
+    settled += ctx.settled_count();
+  }
+  const double seconds = stopwatch.elapsed_seconds();
+
+  std::cout << name <<
+               ": solved " << solved <<
+               " of " << queries.size() <<
+               " in " << seconds <<
+               " s, visited vertices per query: " << (static_cast<double>(settled) / queries.size()) << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  demo::v3::Graph v3_graph{argv[1]};
+  const auto permutation = demo::make_permutation(v3_graph, demo::Ordering::kHilbert);
+  v3_graph.shuffle(permutation.indices());
+
+  demo::a3::Graph a3_graph{argv[1]};
+  a3_graph.shuffle(permutation.indices());
+
+  // Bidirectional searches read the transposed copy kept beside these
+  demo::v6::Graph v6_graph{argv[1]};
+  v6_graph.shuffle(permutation.indices());
+
+  demo::a5::Graph a5_graph{argv[1]};
+  a5_graph.shuffle(permutation.indices());
+
+  const auto queries = bench::make_random_queries(
+    v3_graph.vertex_count(),
+    (argc > 2) ? std::stoul(argv[2]) : 1000,
+    (argc > 3) ? std::stoul(argv[3]) : 1);
+
+  report<bench::CountingTerminateAtGoal<demo::v3::TerminateAtGoal>>("v3 (Dijkstra)", v3_graph, queries);
+  report<demo::v6::BasicTerminateAtGoal<demo::v6::Graph>>("v6 (bidirectional Dijkstra)", v6_graph, queries);
+  report<bench::CountingTerminateAtGoal<demo::a3::TerminateAtGoal>>("a3 (A*)", a3_graph, queries);
+  report<demo::a5::BasicTerminateAtGoal<demo::a5::Graph>>("a5 (bidirectional A*)", a5_graph, queries);
+
+  return 0;
+}
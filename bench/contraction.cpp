@@ -0,0 +1,118 @@
+// C++ Standard Library
+#include <algorithm>
+#include <iostream>
+
+// CppCon
+#include <cppcon/contraction_hierarchy.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+
+using namespace cppcon;
+
+/**
+ * v3::Graph alongside a contraction hierarchy built from it
+ */
+struct HierarchicalGraph
+{
+  const demo::v3::Graph& graph;
+  ContractionHierarchy ch;
+
+  const VertexProperties& vertex(vertex_id_t q) const { return graph.vertex(q); }
+
+  std::size_t vertex_count() const { return graph.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  const ContractionHierarchy& hierarchy() const { return ch; }
+};
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<witness_search_limit>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 10000;
+  const std::size_t witness_search_limit = (argc > 3) ? std::stoul(argv[3]) : 500;
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  demo::v3::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  std::size_t edge_count = 0;
+  for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+  {
+    graph.for_each_edge(q, [&edge_count](vertex_id_t, const EdgeProperties&) { ++edge_count; });
+  }
+
+  const bench::Stopwatch preprocessing_stopwatch;
+  const HierarchicalGraph hierarchical_graph{graph, ContractionHierarchy{graph, witness_search_limit}};
+  std::cout << "Contracted " << graph.vertex_count() <<
+               " vertices in " << preprocessing_stopwatch.elapsed_seconds() <<
+               " s, " << edge_count <<
+               " edges -> " << hierarchical_graph.ch.arc_count() << " arcs" << std::endl;
+
+  const auto queries = bench::make_random_queries(graph.vertex_count(), query_count, seed);
+
+  std::size_t mismatches = 0;
+  {
+    // Check unpacked path lengths against Dijkstra on a subset of queries
+    demo::v3::TerminateAtGoal reference;
+    HierarchyQuery ctx;
+    std::vector<vertex_id_t> reference_path;
+    std::vector<vertex_id_t> path;
+    for (std::size_t i = 0; i < std::min<std::size_t>(queries.size(), 100); ++i)
+    {
+      reference.set_goal(queries[i].goal);
+      ctx.set_goal(queries[i].goal);
+      const bool found = search(ctx, hierarchical_graph, queries[i].start);
+      if (found != search(reference, graph, queries[i].start))
+      {
+        ++mismatches;
+      }
+      else if (found)
+      {
+        reference_path.clear();
+        get_reverse_path(std::back_inserter(reference_path), reference, queries[i].goal);
+        path.clear();
+        get_reverse_path(std::back_inserter(path), ctx, queries[i].goal);
+        const auto length = bench::reverse_path_length(graph, path);
+        mismatches += (length != ctx.path_length()) or (length != bench::reverse_path_length(graph, reference_path));
+      }
+    }
+  }
+
+  HierarchyQuery ctx;
+  std::size_t solved = 0;
+  std::size_t settled = 0;
+  std::vector<vertex_id_t> path;
+  const bench::Stopwatch query_stopwatch;
+  for (const auto& q : queries)
+  {
+    ctx.set_goal(q.goal);
+    if (search(ctx, hierarchical_graph, q.start))
+    {
+      path.clear();
+      get_reverse_path(std::back_inserter(path), ctx, q.goal);
+      ++solved;
+    }
+    settled += ctx.settled_count();
+  }
+  const double seconds = query_stopwatch.elapsed_seconds();
+
+  std::cout << "Solved " << solved <<
+               " of " << queries.size() <<
+               " in " << (1e6 * seconds / queries.size()) <<
+               " us/query (with path unpacking), settled vertices per query: " << (static_cast<double>(settled) / queries.size()) <<
+               ", length mismatches against Dijkstra: " << mismatches << std::endl;
+
+  return 0;
+}
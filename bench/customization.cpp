@@ -0,0 +1,218 @@
+// C++ Standard Library
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <thread>
+
+// CppCon
+#include <cppcon/customizable_contraction_hierarchy.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+
+using namespace cppcon;
+
+/**
+ * v3::Graph with every edge weight replaced from an array, indexed in the order edges are visited
+ *
+ * Stands in for live traffic data: infinite weights close edges.
+ */
+struct ReweightedGraph
+{
+  explicit ReweightedGraph(const demo::v3::Graph& g) :
+    graph{g}
+  {
+    offsets.push_back(0);
+    for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+    {
+      graph.for_each_edge(
+        q,
+        [this](vertex_id_t, const EdgeProperties& edge)
+        {
+          weights.push_back(edge.valid ? edge.weight : CustomizableContractionHierarchy::kInfinite);
+        });
+      offsets.push_back(weights.size());
+    }
+  }
+
+  const VertexProperties& vertex(vertex_id_t q) const { return graph.vertex(q); }
+
+  std::size_t vertex_count() const { return graph.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    std::size_t e = offsets[q];
+    graph.for_each_edge(
+      q,
+      [this, &e, &visitor](vertex_id_t v, const EdgeProperties&)
+      {
+        EdgeProperties edge{weights[e] == CustomizableContractionHierarchy::kInfinite ? 0 : weights[e]};
+        edge.valid = weights[e] != CustomizableContractionHierarchy::kInfinite;
+        ++e;
+        visitor(v, edge);
+      });
+  }
+
+  const demo::v3::Graph& graph;
+  std::vector<std::size_t> offsets;
+  std::vector<edge_weight_t> weights;
+};
+
+/**
+ * ReweightedGraph alongside a customizable contraction hierarchy built from it
+ */
+struct HierarchicalGraph
+{
+  const ReweightedGraph& graph;
+  CustomizableContractionHierarchy cch;
+
+  const VertexProperties& vertex(vertex_id_t q) const { return graph.vertex(q); }
+
+  std::size_t vertex_count() const { return graph.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  const CustomizableContractionHierarchy& hierarchy() const { return cch; }
+};
+
+/**
+ * Returns the number of queries whose unpacked path lengths differ from Dijkstra, checking at most \c limit
+ */
+std::size_t count_mismatches(const HierarchicalGraph& hierarchical_graph, const std::vector<bench::Query>& queries, std::size_t limit)
+{
+  std::size_t mismatches = 0;
+  demo::v3::TerminateAtGoal reference;
+  CustomizableHierarchyQuery ctx;
+  std::vector<vertex_id_t> reference_path;
+  std::vector<vertex_id_t> path;
+  for (std::size_t i = 0; i < std::min(queries.size(), limit); ++i)
+  {
+    reference.set_goal(queries[i].goal);
+    ctx.set_goal(queries[i].goal);
+    const bool found = search(ctx, hierarchical_graph, queries[i].start);
+    if (found != search(reference, hierarchical_graph.graph, queries[i].start))
+    {
+      ++mismatches;
+    }
+    else if (found)
+    {
+      reference_path.clear();
+      get_reverse_path(std::back_inserter(reference_path), reference, queries[i].goal);
+      path.clear();
+      get_reverse_path(std::back_inserter(path), ctx, queries[i].goal);
+      const auto length = bench::reverse_path_length(hierarchical_graph.graph, path);
+      mismatches += (length != ctx.path_length()) or (length != bench::reverse_path_length(hierarchical_graph.graph, reference_path));
+    }
+  }
+  return mismatches;
+}
+
+/**
+ * Runs hierarchy queries, unpacking every path found
+ */
+bench::QueryStats run_queries(const HierarchicalGraph& hierarchical_graph, const std::vector<bench::Query>& queries)
+{
+  bench::QueryStats stats;
+  CustomizableHierarchyQuery ctx;
+  std::vector<vertex_id_t> path;
+  const bench::Stopwatch stopwatch;
+  for (const auto& q : queries)
+  {
+    ctx.set_goal(q.goal);
+    if (search(ctx, hierarchical_graph, q.start))
+    {
+      path.clear();
+      get_reverse_path(std::back_inserter(path), ctx, q.goal);
+      ++stats.solved;
+    }
+  }
+  stats.seconds = stopwatch.elapsed_seconds();
+  return stats;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<changed_edge_percentage>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 10000;
+  const double changed_edge_percentage = (argc > 3) ? std::stod(argv[3]) : 5.0;
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  demo::v3::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  ReweightedGraph reweighted_graph{graph};
+
+  const bench::Stopwatch preprocessing_stopwatch;
+  HierarchicalGraph hierarchical_graph{reweighted_graph, CustomizableContractionHierarchy{reweighted_graph}};
+  std::cout << "Ordered and contracted " << graph.vertex_count() <<
+               " vertices in " << preprocessing_stopwatch.elapsed_seconds() <<
+               " s, " << reweighted_graph.weights.size() <<
+               " edges -> " << hierarchical_graph.cch.arc_count() << " arcs" << std::endl;
+
+  const std::size_t max_thread_count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  for (std::size_t thread_count = 1; thread_count <= max_thread_count; thread_count *= 2)
+  {
+    const bench::Stopwatch stopwatch;
+    hierarchical_graph.cch.customize(reweighted_graph, thread_count);
+    std::cout << "Customized with " << thread_count << " thread(s) in " << (1e3 * stopwatch.elapsed_seconds()) << " ms" << std::endl;
+  }
+
+  const auto queries = bench::make_random_queries(graph.vertex_count(), query_count, seed);
+
+  {
+    const auto stats = run_queries(hierarchical_graph, queries);
+    std::cout << "Solved " << stats.solved <<
+                 " of " << queries.size() <<
+                 " in " << (1e6 * stats.seconds / queries.size()) <<
+                 " us/query (with path unpacking), length mismatches against Dijkstra: " << count_mismatches(hierarchical_graph, queries, 100) << std::endl;
+  }
+
+  // Change some weights, as traffic would, and close some edges outright
+  std::mt19937 rng{static_cast<std::mt19937::result_type>(seed)};
+  std::uniform_real_distribution<double> percent{0.0, 100.0};
+  for (auto& w : reweighted_graph.weights)
+  {
+    if (const double p = percent(rng); p < changed_edge_percentage / 10.0)
+    {
+      w = CustomizableContractionHierarchy::kInfinite;
+    }
+    else if (p < changed_edge_percentage and w != CustomizableContractionHierarchy::kInfinite)
+    {
+      w *= 4;
+    }
+  }
+
+  const bench::Stopwatch stopwatch;
+  hierarchical_graph.cch.customize(reweighted_graph, max_thread_count);
+  std::cout << "Re-customized after changing " << changed_edge_percentage <<
+               "% of edges in " << (1e3 * stopwatch.elapsed_seconds()) << " ms" << std::endl;
+
+  {
+    const auto stats = run_queries(hierarchical_graph, queries);
+    std::cout << "Solved " << stats.solved <<
+                 " of " << queries.size() <<
+                 " in " << (1e6 * stats.seconds / queries.size()) <<
+                 " us/query (with path unpacking), length mismatches against Dijkstra: " << count_mismatches(hierarchical_graph, queries, 100) << std::endl;
+  }
+
+  {
+    demo::v3::TerminateAtGoal ctx;
+    const auto stats = bench::run_queries(ctx, reweighted_graph, queries);
+    std::cout << "Dijkstra solved " << stats.solved <<
+                 " of " << queries.size() <<
+                 " in " << (1e6 * stats.seconds / queries.size()) << " us/query" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+// C++ Standard Library
+#include <iostream>
+#include <vector>
+
+// CppCon
+#include <cppcon/delta_stepping.h>
+#include <cppcon/landmarks.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/parallel.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+using namespace cppcon;
+
+/**
+ * Returns the number of vertices whose distance differs from the reference, or whose predecessor is not
+ * on a shortest path to it
+ */
+template<SearchGraph G>
+std::size_t count_mismatches(const G& graph, const DeltaStepping& ctx, const DistanceTree& reference, vertex_id_t start)
+{
+  std::size_t mismatches = 0;
+  for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+  {
+    const bool reached = reference.distance(q) != DistanceTree::kUnreached;
+    if (reached != ctx.is_reached(q) or (reached and reference.distance(q) != ctx.distance(q)))
+    {
+      ++mismatches;
+    }
+    else if (reached and q != start)
+    {
+      bool tight = false;
+      graph.for_each_edge(
+        ctx.predecessor(q),
+        [&](vertex_id_t v, const EdgeProperties& edge)
+        {
+          tight = tight or (v == q and edge.valid and ctx.distance(ctx.predecessor(q)) + edge.weight == ctx.distance(q));
+        });
+      mismatches += !tight;
+    }
+  }
+  return mismatches;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<source_count>] [<max_threads>] [<delta: 0 for automatic>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t source_count = (argc > 2) ? std::stoul(argv[2]) : 20;
+  const std::size_t max_threads = (argc > 3) ? std::stoul(argv[3]) : demo::default_thread_count();
+  const edge_weight_t delta = (argc > 4) ? std::stoul(argv[4]) : 0;
+  const std::size_t seed = (argc > 5) ? std::stoul(argv[5]) : 1;
+
+  demo::v3_csr::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  // Goals are set to the source, so each query is a full single-source search to the farthest goal below
+  const auto queries = bench::make_random_queries(graph.vertex_count(), source_count, seed);
+
+  // Baseline: single-threaded v3 Dijkstra to the vertex farthest from each source
+  std::vector<vertex_id_t> farthest;
+  DistanceTree reference;
+  for (const auto& q : queries)
+  {
+    search(reference, graph, q.start);
+    farthest.push_back(reference.settled().back());
+  }
+
+  demo::v3::TerminateAtGoal dijkstra;
+  double dijkstra_seconds = 0.0;
+  {
+    const bench::Stopwatch stopwatch;
+    for (std::size_t i = 0; i < queries.size(); ++i)
+    {
+      dijkstra.set_goal(farthest[i]);
+      search(dijkstra, graph, queries[i].start);
+    }
+    dijkstra_seconds = stopwatch.elapsed_seconds();
+  }
+  std::cout << "v3 Dijkstra to the farthest vertex: " << (1e3 * dijkstra_seconds / queries.size()) << " ms/query" << std::endl;
+
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t n = 1; n < max_threads; n *= 2)
+  {
+    thread_counts.push_back(n);
+  }
+  thread_counts.push_back(std::max<std::size_t>(1, max_threads));
+
+  for (const std::size_t thread_count : thread_counts)
+  {
+    DeltaStepping ctx{thread_count, delta};
+    double seconds = 0.0;
+    std::size_t phases = 0;
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < queries.size(); ++i)
+    {
+      ctx.set_goal(farthest[i]);
+      const bench::Stopwatch stopwatch;
+      search(ctx, graph, queries[i].start);
+      seconds += stopwatch.elapsed_seconds();
+      phases += ctx.phase_count();
+
+      search(reference, graph, queries[i].start);
+      mismatches += count_mismatches(graph, ctx, reference, queries[i].start);
+    }
+    std::cout << "delta-stepping (delta " << ctx.delta() <<
+                 "), " << thread_count <<
+                 " thread(s): " << (1e3 * seconds / queries.size()) <<
+                 " ms/query, speedup over v3 " << (dijkstra_seconds / seconds) <<
+                 ", " << (phases / queries.size()) <<
+                 " phases/query, mismatches: " << mismatches << std::endl;
+  }
+
+  return 0;
+}
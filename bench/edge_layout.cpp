@@ -0,0 +1,54 @@
+// C++ Standard Library
+#include <iostream>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v3_soa/graph.h>
+
+using namespace cppcon;
+
+template<SearchGraph G>
+void report(const char* name, const G& graph, std::size_t bytes_per_edge, const std::vector<bench::Query>& queries)
+{
+  std::size_t edge_count = 0;
+  for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+  {
+    graph.for_each_edge(q, [&edge_count](vertex_id_t, const EdgeProperties&) { ++edge_count; });
+  }
+
+  demo::v3::TerminateAtGoal ctx;
+  const auto stats = bench::run_queries(ctx, graph, queries);
+
+  std::cout << name <<
+               ": " << bytes_per_edge <<
+               " bytes/edge (" << (bytes_per_edge * edge_count / 1024) <<
+               " KiB of edges, " << (64 / bytes_per_edge) <<
+               " edges per cache line), solved " << stats.solved <<
+               " of " << queries.size() <<
+               " queries in " << stats.seconds <<
+               " s" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const demo::v3::Graph aos_graph{argv[1]};
+  const demo::v3_soa::Graph soa_graph{argv[1]};
+
+  const auto queries = bench::make_random_queries(
+    aos_graph.vertex_count(),
+    (argc > 2) ? std::stoul(argv[2]) : 1000,
+    (argc > 3) ? std::stoul(argv[3]) : 1);
+
+  report("v3 (array of Edge)", aos_graph, sizeof(Edge), queries);
+  report("v3_soa (successor/weight arrays)", soa_graph, sizeof(vertex_id_t) + sizeof(edge_weight_t), queries);
+
+  return 0;
+}
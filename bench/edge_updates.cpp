@@ -0,0 +1,96 @@
+// C++ Standard Library
+#include <iostream>
+#include <map>
+#include <random>
+#include <utility>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+using namespace cppcon;
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<batch_count>] [<batch_size>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t batch_count = (argc > 2) ? std::stoul(argv[2]) : 10000;
+  const std::size_t batch_size = (argc > 3) ? std::stoul(argv[3]) : 100;
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  demo::v3_csr::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  // Existing edges, from which closures, re-openings and weight changes are drawn
+  std::vector<EdgeUpdate> edges;
+  for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+  {
+    graph.for_each_edge(q, [&edges, q](vertex_id_t v, const EdgeProperties& edge) { edges.push_back(EdgeUpdate{q, v, edge}); });
+  }
+
+  std::mt19937 rng{static_cast<std::mt19937::result_type>(seed)};
+  std::uniform_int_distribution<std::size_t> random_edge{0, edges.size() - 1};
+  std::uniform_int_distribution<int> random_kind{0, 2};
+
+  std::vector<std::vector<EdgeUpdate>> batches(batch_count);
+  for (auto& batch : batches)
+  {
+    for (std::size_t i = 0; i < batch_size; ++i)
+    {
+      EdgeUpdate update = edges[random_edge(rng)];
+      switch (random_kind(rng))
+      {
+        case 0: update.edge.valid = false; break;
+        case 1: update.edge.weight *= 4; break;
+        default: break;
+      }
+      batch.push_back(update);
+    }
+  }
+
+  std::size_t unmatched = 0;
+  const bench::Stopwatch stopwatch;
+  for (const auto& batch : batches)
+  {
+    unmatched += graph.update_edges(batch);
+  }
+  const double seconds = stopwatch.elapsed_seconds();
+
+  // Every named edge must now hold the properties of the last update which named it
+  std::map<std::pair<vertex_id_t, vertex_id_t>, EdgeProperties> expected;
+  for (const auto& batch : batches)
+  {
+    for (const auto& update : batch)
+    {
+      expected.insert_or_assign(std::make_pair(update.pred, update.succ), update.edge);
+    }
+  }
+  std::size_t mismatches = 0;
+  for (const auto& [pred_and_succ, properties] : expected)
+  {
+    const auto* edge = graph.find_edge(pred_and_succ.first, pred_and_succ.second);
+    mismatches += (edge == nullptr) or (edge->valid != properties.valid) or (edge->weight != properties.weight);
+  }
+
+  const std::size_t update_count = batch_count * batch_size;
+  std::cout << "Applied " << update_count <<
+               " updates in batches of " << batch_size <<
+               " in " << (1e9 * seconds / update_count) <<
+               " ns/update (" << (update_count / seconds) <<
+               " updates/s), unmatched: " << unmatched <<
+               ", mismatches: " << mismatches << std::endl;
+
+  const bench::Stopwatch rebuild_stopwatch;
+  const demo::v3_csr::Graph rebuilt{demo::CSRData{
+    .vertices = {graph.view().vertices().begin(), graph.view().vertices().end()},
+    .offsets = {graph.view().offsets().begin(), graph.view().offsets().end()},
+    .edges = {graph.view().edges().begin(), graph.view().edges().end()}}};
+  std::cout << "Rebuilding the graph instead takes " << (1e3 * rebuild_stopwatch.elapsed_seconds()) << " ms" << std::endl;
+
+  return 0;
+}
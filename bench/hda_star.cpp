@@ -0,0 +1,127 @@
+// C++ Standard Library
+#include <iostream>
+#include <vector>
+
+// CppCon
+#include <cppcon/hash_distributed_astar.h>
+#include <cppcon/incremental_planner.h>
+#include <cppcon/landmarks.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/parallel.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/a3/context.h>
+#include <cppcon/demo/a3/graph.h>
+#include <cppcon/demo/a4/context.h>
+
+using namespace cppcon;
+
+using EuclideanHeuristic = demo::a4::EuclideanHeuristic<demo::a3::Graph>;
+
+template<typename H>
+void report(const char* name, const demo::a3::Graph& graph, const std::vector<bench::Query>& queries, const std::vector<edge_weight_t>& shortest, std::size_t thread_count, double a3_seconds)
+{
+  HashDistributedAStar<H> ctx{thread_count};
+  double seconds = 0.0;
+  std::size_t expanded = 0;
+  std::size_t messages = 0;
+  std::size_t suboptimal = 0;
+  std::size_t invalid = 0;
+  std::uint64_t excess = 0;
+  std::vector<vertex_id_t> path;
+
+  for (std::size_t i = 0; i < queries.size(); ++i)
+  {
+    ctx.set_goal(queries[i].goal);
+    const bench::Stopwatch stopwatch;
+    const bool found = search(ctx, graph, queries[i].start);
+    seconds += stopwatch.elapsed_seconds();
+    expanded += ctx.expanded_count();
+    messages += ctx.message_count();
+
+    if (!found)
+    {
+      invalid += (shortest[i] != DistanceTree::kUnreached);
+      continue;
+    }
+    // Judged by the path returned: with a heuristic which overestimates, some improvements to it are pruned
+    // once the goal is reached, so it may be shorter than path_length(), though never invalid
+    path.clear();
+    get_reverse_path(std::back_inserter(path), ctx, queries[i].goal);
+    const edge_weight_t length = bench::reverse_path_length(graph, path);
+    if (length == bench::kInvalidPathLength or path.back() != queries[i].start)
+    {
+      ++invalid;
+      continue;
+    }
+    suboptimal += (length != shortest[i]);
+    excess += length - shortest[i];
+  }
+
+  std::cout << name <<
+               ", " << thread_count <<
+               " thread(s): " << (1e3 * seconds / queries.size()) <<
+               " ms/query, speedup over a3 " << (a3_seconds / seconds) <<
+               ", " << (expanded / queries.size()) <<
+               " expanded/query, " << (messages / queries.size()) <<
+               " messages/query, suboptimal: " << suboptimal <<
+               " (total excess " << excess <<
+               "), invalid: " << invalid << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<max_threads>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 20;
+  const std::size_t max_threads = (argc > 3) ? std::stoul(argv[3]) : demo::default_thread_count();
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  demo::a3::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  const auto queries = bench::make_random_queries(graph.vertex_count(), query_count, seed);
+
+  std::vector<edge_weight_t> shortest;
+  DistanceTree tree;
+  for (const auto& q : queries)
+  {
+    search(tree, graph, q.start);
+    shortest.push_back(tree.distance(q.goal));
+  }
+
+  double a3_seconds = 0.0;
+  {
+    demo::a3::TerminateAtGoal ctx;
+    const bench::Stopwatch stopwatch;
+    for (const auto& q : queries)
+    {
+      ctx.set_goal(q.goal);
+      search(ctx, graph, q.start);
+    }
+    a3_seconds = stopwatch.elapsed_seconds();
+  }
+  std::cout << "a3: " << (1e3 * a3_seconds / queries.size()) << " ms/query" << std::endl;
+
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t n = 1; n < max_threads; n *= 2)
+  {
+    thread_counts.push_back(n);
+  }
+  thread_counts.push_back(std::max<std::size_t>(1, max_threads));
+
+  // Straight-line distance can overestimate sums of truncated weights slightly; a zero heuristic cannot
+  for (const std::size_t thread_count : thread_counts)
+  {
+    report<EuclideanHeuristic>("HDA* (a3 heuristic)", graph, queries, shortest, thread_count, a3_seconds);
+  }
+  for (const std::size_t thread_count : thread_counts)
+  {
+    report<ZeroHeuristic>("HDA* (zero heuristic)", graph, queries, shortest, thread_count, a3_seconds);
+  }
+
+  return 0;
+}
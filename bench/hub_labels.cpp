@@ -0,0 +1,68 @@
+// C++ Standard Library
+#include <iostream>
+
+// CppCon
+#include <cppcon/contraction_hierarchy.h>
+#include <cppcon/hub_labels.h>
+#include <cppcon/landmarks.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/graph.h>
+
+using namespace cppcon;
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 1000000;
+  const std::size_t seed = (argc > 3) ? std::stoul(argv[3]) : 1;
+
+  demo::v3::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  const bench::Stopwatch ordering_stopwatch;
+  const auto order = order_by_importance(ContractionHierarchy{graph});
+  std::cout << "Ordered " << graph.vertex_count() << " vertices by contraction in " << ordering_stopwatch.elapsed_seconds() << " s" << std::endl;
+
+  const bench::Stopwatch labeling_stopwatch;
+  const HubLabels labels{graph, order};
+  std::cout << "Labeled in " << labeling_stopwatch.elapsed_seconds() <<
+               " s, average label size: " << (static_cast<double>(labels.entry_count()) / (2 * graph.vertex_count())) <<
+               ", memory: " << (labels.memory_bytes() >> 20) << " MiB" << std::endl;
+
+  const auto queries = bench::make_random_queries(graph.vertex_count(), query_count, seed);
+
+  std::size_t mismatches = 0;
+  {
+    // Check distances against full Dijkstra searches from a few starts
+    DistanceTree tree;
+    for (std::size_t i = 0; i < std::min<std::size_t>(queries.size(), 20); ++i)
+    {
+      search(tree, graph, queries[i].start);
+      for (vertex_id_t t = 0; t < graph.vertex_count(); ++t)
+      {
+        mismatches += (labels.distance(queries[i].start, t) != tree.distance(t));
+      }
+    }
+  }
+
+  std::uint64_t total = 0;
+  const bench::Stopwatch query_stopwatch;
+  for (const auto& q : queries)
+  {
+    total += labels.distance(q.start, q.goal);
+  }
+  const double seconds = query_stopwatch.elapsed_seconds();
+  bench::do_not_optimize(total);
+
+  std::cout << "Answered " << queries.size() <<
+               " distance queries in " << (1e9 * seconds / queries.size()) <<
+               " ns/query, mismatches against Dijkstra: " << mismatches << std::endl;
+
+  return 0;
+}
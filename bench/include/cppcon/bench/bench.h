@@ -0,0 +1,342 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+
+// POSIX
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __linux__    // Linux only
+#include <linux/perf_event.h>
+#endif
+
+namespace cppcon::bench
+{
+
+class Stopwatch
+{
+public:
+  Stopwatch() : t_start_{std::chrono::high_resolution_clock::now()} {}
+
+  double elapsed_seconds() const
+  {
+    const auto t_duration = (std::chrono::high_resolution_clock::now() - t_start_);
+    return std::chrono::duration_cast<std::chrono::duration<double>>(t_duration).count();
+  }
+
+private:
+  std::chrono::high_resolution_clock::time_point t_start_;
+};
+
+/**
+ * Returns the peak resident set size of this process, in KiB
+ */
+inline long peak_rss_kib()
+{
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+/**
+ * Hardware event counts of the calling thread, in user space, read with perf_event_open
+ *
+ * Each event is opened on its own, so events which the kernel or (virtual) machine does not expose are
+ * simply reported as unavailable.
+ */
+class PerfCounters
+{
+public:
+  enum Event
+  {
+    kCycles,
+    kInstructions,
+    kL1DReadMisses,
+    kLLCReadMisses,
+    kEventCount
+  };
+
+  using Counts = std::array<std::optional<std::uint64_t>, kEventCount>;
+
+  static constexpr const char* name(Event event)
+  {
+    switch (event)
+    {
+      case kCycles: return "cycles";
+      case kInstructions: return "instructions";
+      case kL1DReadMisses: return "L1D read misses";
+      case kLLCReadMisses: return "LLC read misses";
+      case kEventCount: break;
+    }
+    return "";
+  }
+
+  PerfCounters()
+  {
+#ifdef __linux__
+    constexpr auto cache_read_misses = [](std::uint64_t cache)
+    {
+      return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+    const std::array<std::pair<std::uint32_t, std::uint64_t>, kEventCount> events{{
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HW_CACHE, cache_read_misses(PERF_COUNT_HW_CACHE_L1D)},
+      {PERF_TYPE_HW_CACHE, cache_read_misses(PERF_COUNT_HW_CACHE_LL)},
+    }};
+    for (std::size_t e = 0; e < kEventCount; ++e)
+    {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = events[e].first;
+      attr.config = events[e].second;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      fds_[e] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+  }
+
+  PerfCounters(const PerfCounters&) = delete;
+
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  ~PerfCounters()
+  {
+    for (const int fd : fds_)
+    {
+      if (fd >= 0)
+      {
+        close(fd);
+      }
+    }
+  }
+
+  /**
+   * Returns true if no event could be opened
+   */
+  bool unavailable() const
+  {
+    return std::all_of(fds_.begin(), fds_.end(), [](int fd) { return fd < 0; });
+  }
+
+  void start()
+  {
+#ifdef __linux__
+    for (const int fd : fds_)
+    {
+      if (fd >= 0)
+      {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  /**
+   * Returns the counts of every event since start()
+   */
+  Counts stop()
+  {
+    Counts counts;
+#ifdef __linux__
+    for (std::size_t e = 0; e < kEventCount; ++e)
+    {
+      if (std::uint64_t count; fds_[e] >= 0 and ioctl(fds_[e], PERF_EVENT_IOC_DISABLE, 0) == 0 and read(fds_[e], &count, sizeof(count)) == sizeof(count))
+      {
+        counts[e] = count;
+      }
+    }
+#endif
+    return counts;
+  }
+
+private:
+  std::array<int, kEventCount> fds_{-1, -1, -1, -1};
+};
+
+/**
+ * Runs \c fn in a forked child process, so that per-process statistics (e.g. peak RSS) cover only \c fn
+ */
+template<typename FnT>
+void run_isolated(FnT&& fn)
+{
+  std::cout.flush();
+  std::cerr.flush();
+  if (const pid_t pid = fork(); pid == 0)
+  {
+    fn();
+    std::cout.flush();
+    std::cerr.flush();
+    std::_Exit(0);
+  }
+  else if (pid > 0)
+  {
+    int status;
+    waitpid(pid, &status, 0);
+  }
+  else
+  {
+    std::perror("fork");
+  }
+}
+
+/**
+ * Keeps the compiler from discarding a computed value
+ */
+template<typename T>
+void do_not_optimize(const T& value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Context which counts the vertices it visits, for contexts which do not count them themselves
+ */
+template<typename BaseT>
+class CountingTerminateAtGoal : public BaseT
+{
+public:
+  template<SearchGraph G>
+  void reset(G&& graph, vertex_id_t s)
+  {
+    settled_count_ = 0;
+    BaseT::reset(graph, s);
+  }
+
+  void mark_visited(vertex_id_t p, vertex_id_t s)
+  {
+    ++settled_count_;
+    BaseT::mark_visited(p, s);
+  }
+
+  std::size_t settled_count() const { return settled_count_; }
+
+private:
+  std::size_t settled_count_ = 0;
+};
+
+/// Length of a path which uses an edge the graph does not have
+constexpr edge_weight_t kInvalidPathLength = std::numeric_limits<edge_weight_t>::max();
+
+/**
+ * Returns the total weight of a path given from its last vertex back to its first, taking the lightest valid
+ * edge between each pair of vertices, or kInvalidPathLength if some pair has no valid edge
+ */
+template<SearchGraph G>
+edge_weight_t reverse_path_length(const G& graph, const std::vector<vertex_id_t>& path)
+{
+  edge_weight_t length = 0;
+  for (std::size_t i = path.size(); i > 1; --i)
+  {
+    edge_weight_t shortest = kInvalidPathLength;
+    graph.for_each_edge(
+      path[i - 1],
+      [&shortest, next=path[i - 2]](vertex_id_t v, const EdgeProperties& edge)
+      {
+        if (edge.valid and v == next)
+        {
+          shortest = std::min(shortest, edge.weight);
+        }
+      });
+    if (shortest == kInvalidPathLength)
+    {
+      return kInvalidPathLength;
+    }
+    length += shortest;
+  }
+  return length;
+}
+
+/**
+ * Number of queries solved and of vertices on all paths found; equal for equal results
+ */
+struct PathChecksum
+{
+  std::size_t solved = 0;
+  std::size_t vertices = 0;
+
+  template<SearchContext C>
+  void add(const C& ctx, vertex_id_t goal, bool found)
+  {
+    if (found)
+    {
+      ++solved;
+      for (vertex_id_t q = goal; ctx.predecessor(q) != q; q = ctx.predecessor(q))
+      {
+        ++vertices;
+      }
+    }
+  }
+
+  bool operator==(const PathChecksum&) const = default;
+};
+
+struct Query
+{
+  vertex_id_t start;
+  vertex_id_t goal;
+};
+
+/**
+ * Returns uniformly sampled (start, goal) pairs; the same seed always gives the same queries
+ */
+inline std::vector<Query> make_random_queries(std::size_t vertex_count, std::size_t query_count, std::size_t seed)
+{
+  std::mt19937 rng{static_cast<std::mt19937::result_type>(seed)};
+  std::uniform_int_distribution<vertex_id_t> dist{0, static_cast<vertex_id_t>(vertex_count - 1)};
+  std::vector<Query> queries;
+  queries.reserve(query_count);
+  for (std::size_t i = 0; i < query_count; ++i)
+  {
+    queries.push_back(Query{.start = dist(rng), .goal = dist(rng)});
+  }
+  return queries;
+}
+
+struct QueryStats
+{
+  double seconds = 0.0;
+  std::size_t solved = 0;
+};
+
+/**
+ * Runs search() for every query with a context which is reused across queries
+ */
+template<SearchContext C, SearchGraph G>
+QueryStats run_queries(C& ctx, const G& graph, const std::vector<Query>& queries)
+{
+  QueryStats stats;
+  const Stopwatch stopwatch;
+  for (const auto& q : queries)
+  {
+    ctx.set_goal(q.goal);
+    stats.solved += search(ctx, graph, q.start);
+  }
+  stats.seconds = stopwatch.elapsed_seconds();
+  return stats;
+}
+
+}  // namespace cppcon::bench
@@ -0,0 +1,277 @@
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string_view>
+
+// CppCon
+#include <cppcon/incremental_planner.h>
+#include <cppcon/landmarks.h>
+#include <cppcon/transpose.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/parallel.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+using namespace cppcon;
+
+/**
+ * v3_csr::Graph with landmark distances of its original weights
+ *
+ * Blockages only close edges or raise their weights, so original distances stay consistent lower bounds.
+ */
+struct LandmarkGraph
+{
+  const VertexProperties& vertex(vertex_id_t q) const { return graph.vertex(q); }
+
+  std::size_t vertex_count() const { return graph.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  const LandmarkTable& landmarks() const { return table; }
+
+  demo::v3_csr::Graph graph;
+  LandmarkTable table;
+};
+
+// Straight-line distance is not a consistent bound on sums of truncated integer weights, which D* Lite needs
+using Planner = IncrementalPlanner<LandmarkSourceHeuristic<LandmarkGraph>>;
+
+enum class Blockage
+{
+  /// Every edge around a vertex a few steps ahead on the current path is closed
+  kClosureAhead,
+  /// Every edge around a random vertex is closed
+  kClosureElsewhere,
+  /// Every edge within a few hops of a random vertex is slowed down four times
+  kCongestion,
+};
+
+constexpr std::array<Blockage, 3> kBlockages{Blockage::kClosureAhead, Blockage::kClosureElsewhere, Blockage::kCongestion};
+
+constexpr std::string_view to_string(Blockage blockage)
+{
+  switch (blockage)
+  {
+    case Blockage::kClosureAhead: return "closure ahead";
+    case Blockage::kClosureElsewhere: return "closure elsewhere";
+    case Blockage::kCongestion: return "congestion";
+  }
+  return "";
+}
+
+struct ReplanStats
+{
+  std::size_t count = 0;
+  std::size_t mismatches = 0;
+  double incremental_seconds = 0.0;
+  double scratch_seconds = 0.0;
+  double dijkstra_seconds = 0.0;
+  std::size_t incremental_settled = 0;
+  std::size_t scratch_settled = 0;
+};
+
+/**
+ * Returns updates for every edge into or out of a vertex within \c hops of \c center, other than \c keep_a
+ * and \c keep_b, using \c make_edge to derive each new edge from the current one
+ */
+template<typename MakeEdgeT>
+std::vector<EdgeUpdate> updates_around(
+  const LandmarkGraph& graph,
+  const TransposedGraph<LandmarkGraph>& reverse_graph,
+  vertex_id_t center,
+  std::size_t hops,
+  vertex_id_t keep_a,
+  vertex_id_t keep_b,
+  MakeEdgeT make_edge)
+{
+  std::vector<vertex_id_t> frontier{center};
+  std::vector<vertex_id_t> region{center};
+  for (std::size_t hop = 0; hop < hops; ++hop)
+  {
+    std::vector<vertex_id_t> next;
+    for (const vertex_id_t q : frontier)
+    {
+      graph.for_each_edge(
+        q,
+        [&region, &next](vertex_id_t v, const EdgeProperties&)
+        {
+          if (std::find(region.begin(), region.end(), v) == region.end())
+          {
+            region.push_back(v);
+            next.push_back(v);
+          }
+        });
+    }
+    frontier = std::move(next);
+  }
+
+  std::vector<EdgeUpdate> updates;
+  for (const vertex_id_t q : region)
+  {
+    if (q == keep_a or q == keep_b)
+    {
+      continue;
+    }
+    graph.for_each_edge(q, [&](vertex_id_t v, const EdgeProperties& edge) { updates.push_back(EdgeUpdate{q, v, make_edge(edge)}); });
+    reverse_graph.for_each_edge(q, [&](vertex_id_t u, const EdgeProperties&) { updates.push_back(EdgeUpdate{u, q, make_edge(*graph.graph.find_edge(u, q))}); });
+  }
+  return updates;
+}
+
+/**
+ * Returns the length of the shortest path from \c start to \c goal found by v3 Dijkstra, or kInfinite
+ */
+edge_weight_t dijkstra_length(demo::v3::TerminateAtGoal& ctx, const LandmarkGraph& graph, vertex_id_t start, vertex_id_t goal, std::vector<vertex_id_t>& path)
+{
+  ctx.set_goal(goal);
+  if (!search(ctx, graph, start))
+  {
+    return Planner::kInfinite;
+  }
+
+  path.clear();
+  get_reverse_path(std::back_inserter(path), ctx, goal);
+  return bench::reverse_path_length(graph, path);
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<journey_count>] [<blockages_per_journey>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t journey_count = (argc > 2) ? std::stoul(argv[2]) : 100;
+  const std::size_t blockages_per_journey = (argc > 3) ? std::stoul(argv[3]) : 4;
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  demo::v3_csr::Graph original_graph{argv[1]};
+  original_graph.shuffle(demo::make_permutation(original_graph, demo::Ordering::kHilbert).indices());
+
+  LandmarkGraph graph{original_graph, LandmarkTable{}};
+  graph.table = LandmarkTable{graph, 16, LandmarkSelection::kFarthest, demo::default_thread_count()};
+  const TransposedGraph<LandmarkGraph> reverse_graph{graph};
+
+  std::mt19937 rng{static_cast<std::mt19937::result_type>(seed)};
+  std::uniform_int_distribution<vertex_id_t> random_vertex{0, static_cast<vertex_id_t>(graph.vertex_count() - 1)};
+
+  std::array<ReplanStats, kBlockages.size()> stats;
+
+  Planner planner;
+  Planner scratch;
+  demo::v3::TerminateAtGoal dijkstra;
+  std::vector<vertex_id_t> path;
+  std::vector<vertex_id_t> scratch_path;
+
+  for (std::size_t journey = 0; journey < journey_count; ++journey)
+  {
+    const vertex_id_t goal = random_vertex(rng);
+    vertex_id_t position = random_vertex(rng);
+
+    planner.set_goal(goal);
+    if (!search(planner, graph, position))
+    {
+      continue;
+    }
+
+    std::vector<EdgeUpdate> restore;
+    for (std::size_t b = 0; b < blockages_per_journey and position != goal; ++b)
+    {
+      path.clear();
+      get_reverse_path(std::back_inserter(path), planner, goal);
+      std::reverse(path.begin(), path.end());
+
+      // Travel part of the way before the map changes
+      position = path[std::min(path.size() - 1, path.size() / (blockages_per_journey + 1 - b))];
+      if (position == goal)
+      {
+        break;
+      }
+
+      const Blockage blockage = kBlockages[b % kBlockages.size()];
+      std::vector<EdgeUpdate> updates;
+      switch (blockage)
+      {
+        case Blockage::kClosureAhead:
+        {
+          const std::size_t here = std::find(path.begin(), path.end(), position) - path.begin();
+          const vertex_id_t center = path[std::min(here + 4, path.size() - 1)];
+          updates = updates_around(graph, reverse_graph, center, 1, position, goal, [](EdgeProperties edge) { edge.valid = false; return edge; });
+          break;
+        }
+        case Blockage::kClosureElsewhere:
+        {
+          updates = updates_around(graph, reverse_graph, random_vertex(rng), 1, position, goal, [](EdgeProperties edge) { edge.valid = false; return edge; });
+          break;
+        }
+        case Blockage::kCongestion:
+        {
+          updates = updates_around(graph, reverse_graph, random_vertex(rng), 3, position, goal, [](EdgeProperties edge) { edge.weight *= 4; return edge; });
+          break;
+        }
+      }
+      for (const auto& update : updates)
+      {
+        restore.push_back(EdgeUpdate{update.pred, update.succ, *original_graph.find_edge(update.pred, update.succ)});
+      }
+      graph.graph.update_edges(updates);
+
+      auto& s = stats[static_cast<std::size_t>(blockage)];
+      ++s.count;
+
+      const bench::Stopwatch incremental_stopwatch;
+      planner.update_edges(graph, std::span<const EdgeUpdate>{updates});
+      const bool found = search(planner, graph, position);
+      s.incremental_seconds += incremental_stopwatch.elapsed_seconds();
+      s.incremental_settled += planner.settled_count();
+
+      scratch.set_goal(goal);
+      scratch.clear();
+      const bench::Stopwatch scratch_stopwatch;
+      const bool scratch_found = search(scratch, graph, position);
+      s.scratch_seconds += scratch_stopwatch.elapsed_seconds();
+      s.scratch_settled += scratch.settled_count();
+
+      const bench::Stopwatch dijkstra_stopwatch;
+      const edge_weight_t length = dijkstra_length(dijkstra, graph, position, goal, scratch_path);
+      s.dijkstra_seconds += dijkstra_stopwatch.elapsed_seconds();
+
+      const edge_weight_t incremental_length = found ? planner.path_length() : Planner::kInfinite;
+      const edge_weight_t scratch_length = scratch_found ? scratch.path_length() : Planner::kInfinite;
+      s.mismatches += (incremental_length != length) or (scratch_length != length);
+
+      if (!found)
+      {
+        break;
+      }
+    }
+
+    // Re-open everything before the next journey, which may happen to keep the same goal
+    graph.graph.update_edges(restore);
+    planner.update_edges(graph, std::span<const EdgeUpdate>{restore});
+  }
+
+  for (const auto blockage : kBlockages)
+  {
+    const auto& s = stats[static_cast<std::size_t>(blockage)];
+    const double count = std::max<std::size_t>(1, s.count);
+    std::cout << to_string(blockage) << ": " << s.count <<
+                 " replans, incremental " << (1e6 * s.incremental_seconds / count) <<
+                 " us (" << (s.incremental_settled / count) <<
+                 " settled), from scratch " << (1e6 * s.scratch_seconds / count) <<
+                 " us (" << (s.scratch_settled / count) <<
+                 " settled), Dijkstra " << (1e6 * s.dijkstra_seconds / count) <<
+                 " us, length mismatches: " << s.mismatches << std::endl;
+  }
+
+  return 0;
+}
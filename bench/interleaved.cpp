@@ -0,0 +1,125 @@
+// C++ Standard Library
+#include <iostream>
+#include <vector>
+
+// CppCon
+#include <cppcon/interleaved_search.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+using namespace cppcon;
+
+/**
+ * Graph \c G without its prefetch hints
+ */
+template<SearchGraph G>
+struct WithoutPrefetchGraph
+{
+  const VertexProperties& vertex(vertex_id_t q) const { return graph.vertex(q); }
+
+  std::size_t vertex_count() const { return graph.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  const G& graph;
+};
+
+/**
+ * Context \c C without its prefetch hints
+ */
+template<SearchContext C>
+class WithoutPrefetchContext : private C
+{
+public:
+  using C::set_goal;
+  using C::reset;
+  using C::is_queue_not_empty;
+  using C::is_visited;
+  using C::is_terminal;
+  using C::mark_visited;
+  using C::predecessor;
+  using C::dequeue;
+  using C::enqueue;
+};
+
+template<typename C, SearchGraph G>
+void report(const char* name, const G& graph, const std::vector<bench::Query>& queries, std::size_t lane_count, const bench::PathChecksum& expected, double serial_seconds)
+{
+  std::vector<C> lanes(lane_count);
+  bench::PathChecksum checksum;
+
+  const bench::Stopwatch stopwatch;
+  search_interleaved(
+    std::span<C>{lanes},
+    graph,
+    queries.size(),
+    [&queries](std::size_t i) { return std::pair{queries[i].start, queries[i].goal}; },
+    [&checksum, &queries](std::size_t i, const C& ctx, bool found) { checksum.add(ctx, queries[i].goal, found); });
+  const double seconds = stopwatch.elapsed_seconds();
+
+  std::cout << name <<
+               ", " << lane_count <<
+               " lane(s): " << (1e6 * seconds / queries.size()) <<
+               " us/query, speedup " << (serial_seconds / seconds) <<
+               ((checksum == expected) ? "" : " (RESULTS DIFFER)") << std::endl;
+}
+
+template<SearchGraph G>
+void report_all(const char* name, const G& graph, const std::vector<bench::Query>& queries)
+{
+  demo::v3::TerminateAtGoal ctx;
+  bench::PathChecksum expected;
+  const bench::Stopwatch stopwatch;
+  for (const auto& q : queries)
+  {
+    ctx.set_goal(q.goal);
+    expected.add(ctx, q.goal, search(ctx, graph, q.start));
+  }
+  const double serial_seconds = stopwatch.elapsed_seconds();
+  std::cout << name << ", search(): " << (1e6 * serial_seconds / queries.size()) << " us/query, solved " << expected.solved << std::endl;
+
+  for (const std::size_t lane_count : {1, 2, 4, 8, 16, 32})
+  {
+    report<demo::v3::TerminateAtGoal>(name, graph, queries, lane_count, expected, serial_seconds);
+  }
+
+  const WithoutPrefetchGraph<G> without_prefetch{graph};
+  for (const std::size_t lane_count : {1, 8})
+  {
+    report<WithoutPrefetchContext<demo::v3::TerminateAtGoal>>("  without prefetch", without_prefetch, queries, lane_count, expected, serial_seconds);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<ordering: identity|hilbert|rcm|bfs|dfs|random>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 1000;
+  const auto ordering = (argc > 3) ? demo::to_ordering(argv[3]).value_or(demo::Ordering::kHilbert) : demo::Ordering::kHilbert;
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  demo::v3::Graph v3_graph{argv[1]};
+  const auto permutation = demo::make_permutation(v3_graph, ordering, seed);
+  v3_graph.shuffle(permutation.indices());
+
+  demo::v3_csr::Graph v3_csr_graph{argv[1]};
+  v3_csr_graph.shuffle(permutation.indices());
+
+  const auto queries = bench::make_random_queries(v3_graph.vertex_count(), query_count, seed);
+
+  report_all("v3", v3_graph, queries);
+  report_all("v3_csr", v3_csr_graph, queries);
+
+  return 0;
+}
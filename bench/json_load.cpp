@@ -0,0 +1,94 @@
+// C++ Standard Library
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/csr.h>
+#include <cppcon/demo/json.h>
+
+using namespace cppcon;
+
+/**
+ * Graph loading as it was done before the streaming reader: a full picojson document, copied into CSR arrays
+ */
+demo::CSRData load_csr_from_json_document(const std::filesystem::path& path)
+{
+  const auto v = demo::load_json(path);
+  const auto& root = v.get<picojson::object>();
+  const auto& nodes = root.at("nodes").get<picojson::array>();
+  const auto& edges = root.at("edges").get<picojson::array>();
+
+  demo::CSRData csr;
+
+  csr.vertices.reserve(nodes.size());
+  for (const auto& node_value : nodes)
+  {
+    const auto& node_object = node_value.get<picojson::object>();
+    csr.vertices.push_back(VertexProperties{
+      .x = node_object.at("x").get<double>(),
+      .y = node_object.at("y").get<double>(),
+    });
+  }
+
+  csr.offsets.resize(csr.vertices.size() + 1, 0);
+  for (const auto& edge_value : edges)
+  {
+    const vertex_id_t src_vertex_id = edge_value.get<picojson::object>().at("u").get<double>();
+    ++csr.offsets[src_vertex_id + 1];
+  }
+  std::partial_sum(csr.offsets.begin(), csr.offsets.end(), csr.offsets.begin());
+
+  std::vector<demo::edge_offset_t> cursor{csr.offsets.begin(), csr.offsets.end() - 1};
+  csr.edges.resize(edges.size(), Edge{0, EdgeProperties{0}});
+  for (const auto& edge_value : edges)
+  {
+    const auto& edge_object = edge_value.get<picojson::object>();
+    const vertex_id_t src_vertex_id = edge_object.at("u").get<double>();
+    const vertex_id_t dst_vertex_id = edge_object.at("v").get<double>();
+    const edge_weight_t weight = std::max<edge_weight_t>(1, edge_object.at("w").get<double>());
+    csr.edges[cursor[src_vertex_id]++] = Edge{dst_vertex_id, EdgeProperties{weight}};
+  }
+
+  return csr;
+}
+
+template<typename LoadFnT>
+void run_benchmark(const char* name, const std::filesystem::path& graph_in_json, LoadFnT load)
+{
+  bench::run_isolated(
+    [&]
+    {
+      const long rss_before_kib = bench::peak_rss_kib();
+      const bench::Stopwatch stopwatch;
+      const auto csr = load(graph_in_json);
+      const double t_load_secs = stopwatch.elapsed_seconds();
+
+      const std::size_t graph_bytes = csr.vertices.size() * sizeof(VertexProperties) +
+                                      csr.offsets.size() * sizeof(demo::edge_offset_t) +
+                                      csr.edges.size() * sizeof(Edge);
+
+      std::cout << name <<
+                   ": " << t_load_secs <<
+                   " s, peak RSS growth: " << (bench::peak_rss_kib() - rss_before_kib) <<
+                   " KiB, final graph: " << (graph_bytes / 1024) <<
+                   " KiB (" << csr.vertices.size() <<
+                   " vertices, " << csr.edges.size() <<
+                   " edges)" << std::endl;
+    });
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json>" << std::endl;
+    return 1;
+  }
+
+  run_benchmark("load_json (document)", argv[1], load_csr_from_json_document);
+  run_benchmark("GraphJsonReader (streaming)", argv[1], demo::load_csr_from_json);
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+// C++ Standard Library
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// CppCon
+#include <cppcon/landmarks.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/a3/context.h>
+#include <cppcon/demo/a3/graph.h>
+#include <cppcon/demo/a4/context.h>
+#include <cppcon/demo/a6/context.h>
+#include <cppcon/demo/a6/graph.h>
+
+using namespace cppcon;
+
+template<typename C, SearchGraph G>
+void report(const std::string& name, const G& graph, const std::vector<bench::Query>& queries, const std::vector<edge_weight_t>& shortest)
+{
+  C ctx;
+  std::size_t solved = 0;
+  std::size_t settled = 0;
+  std::size_t mismatches = 0;
+  double seconds = 0.0;
+  std::vector<vertex_id_t> path;
+  for (std::size_t i = 0; i < queries.size(); ++i)
+  {
+    ctx.set_goal(queries[i].goal);
+    const bench::Stopwatch stopwatch;
+    const bool found = search(ctx, graph, queries[i].start);
+    seconds += stopwatch.elapsed_seconds();
+    solved += found;
+    settled += ctx.settled_count();
+
+    if (!found)
+    {
+      mismatches += (shortest[i] != DistanceTree::kUnreached);
+      continue;
+    }
+    path.clear();
+    get_reverse_path(std::back_inserter(path), ctx, queries[i].goal);
+    mismatches += (bench::reverse_path_length(graph, path) != shortest[i]);
+  }
+
+  std::cout << name <<
+               ": solved " << solved <<
+               " of " << queries.size() <<
+               " in " << (1e6 * seconds / queries.size()) <<
+               " us/query, settled vertices per query: " << (static_cast<double>(settled) / queries.size()) <<
+               ", length mismatches against Dijkstra: " << mismatches << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 1000;
+  const std::size_t seed = (argc > 3) ? std::stoul(argv[3]) : 1;
+
+  demo::a3::Graph a3_graph{argv[1]};
+  const auto permutation = demo::make_permutation(a3_graph, demo::Ordering::kHilbert);
+  a3_graph.shuffle(permutation.indices());
+
+  const auto queries = bench::make_random_queries(a3_graph.vertex_count(), query_count, seed);
+
+  std::vector<edge_weight_t> shortest;
+  shortest.reserve(queries.size());
+  DistanceTree tree;
+  for (const auto& q : queries)
+  {
+    search(tree, a3_graph, q.start);
+    shortest.push_back(tree.distance(q.goal));
+  }
+
+  // a3 and a4 are shown as in the demos, though their paths are not shortest paths; the a6 key correction
+  // with straight-line distance is the baseline for landmarks, whose paths are only as short as that
+  // distance is a lower bound on edge weights
+  report<bench::CountingTerminateAtGoal<demo::a3::TerminateAtGoal>>("a3 (Euclidean, accumulated)", a3_graph, queries, shortest);
+  report<bench::CountingTerminateAtGoal<demo::a4::BasicTerminateAtGoal<demo::a3::Graph>>>("a4 (Euclidean, accumulated)", a3_graph, queries, shortest);
+  report<bench::CountingTerminateAtGoal<demo::a6::BasicTerminateAtGoal<demo::a3::Graph, demo::a4::EuclideanHeuristic<demo::a3::Graph>>>>("A* (Euclidean)", a3_graph, queries, shortest);
+
+  for (const auto selection : {LandmarkSelection::kFarthest, LandmarkSelection::kAvoid})
+  {
+    const char* selection_name = (selection == LandmarkSelection::kFarthest) ? "farthest" : "avoid";
+    for (const std::size_t landmark_count : {4, 8, 16})
+    {
+      const bench::Stopwatch preprocessing_stopwatch;
+      demo::a6::Graph a6_graph{argv[1], landmark_count, selection};
+      a6_graph.shuffle(permutation.indices());
+      const double preprocessing_seconds = preprocessing_stopwatch.elapsed_seconds();
+
+      const std::string name = "a6 (ALT, " + std::to_string(landmark_count) + " " + selection_name + " landmarks)";
+      std::cout << name << ": loaded and preprocessed in " << preprocessing_seconds << " s" << std::endl;
+      report<bench::CountingTerminateAtGoal<demo::a6::BasicTerminateAtGoal<demo::a6::Graph>>>(name, a6_graph, queries, shortest);
+    }
+  }
+
+  return 0;
+}
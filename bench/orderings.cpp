@@ -0,0 +1,58 @@
+// C++ Standard Library
+#include <iostream>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+
+using namespace cppcon;
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 1000;
+  const std::size_t seed = (argc > 3) ? std::stoul(argv[3]) : 1;
+
+  for (const auto ordering : {demo::Ordering::kIdentity,
+                              demo::Ordering::kRandom,
+                              demo::Ordering::kHilbert,
+                              demo::Ordering::kReverseCuthillMcKee,
+                              demo::Ordering::kBreadthFirst,
+                              demo::Ordering::kDepthFirst})
+  {
+    demo::v3::Graph graph{argv[1]};
+
+    const auto permutation = demo::make_permutation(graph, ordering, seed);
+    const auto locality = demo::compute_locality(graph, permutation);
+    graph.shuffle(permutation.indices());
+
+    // Same external queries for every ordering
+    auto queries = bench::make_random_queries(graph.vertex_count(), query_count, seed);
+    for (auto& q : queries)
+    {
+      q.start = permutation.internal(q.start);
+      q.goal = permutation.internal(q.goal);
+    }
+
+    demo::v3::TerminateAtGoal ctx;
+    const auto stats = bench::run_queries(ctx, graph, queries);
+
+    std::cout << to_string(ordering) <<
+                 ": average edge span: " << locality.average_edge_span <<
+                 ", bandwidth: " << locality.bandwidth <<
+                 ", same cache line: " << (100.0 * locality.same_cache_line_fraction) <<
+                 "%, solved " << stats.solved <<
+                 " of " << queries.size() <<
+                 " queries in " << stats.seconds <<
+                 " s" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+// C++ Standard Library
+#include <filesystem>
+#include <iostream>
+
+// CppCon
+#include <cppcon/landmarks.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/parallel.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3_cpd/context.h>
+#include <cppcon/demo/v3_cpd/path_database.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+using namespace cppcon;
+
+/**
+ * v3_csr::Graph alongside a path database built from it, without the file caching of v3_cpd::Graph
+ */
+struct DatabaseGraph
+{
+  const demo::v3_csr::Graph& graph;
+  const demo::v3_cpd::PathDatabase& database;
+
+  const VertexProperties& vertex(vertex_id_t q) const { return graph.vertex(q); }
+
+  std::size_t vertex_count() const { return graph.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  vertex_id_t successor(vertex_id_t q, std::uint8_t move) const
+  {
+    const auto view = graph.view();
+    return view.edges()[view.offsets()[q] + move].first;
+  }
+
+  const demo::v3_cpd::PathDatabase& path_database() const { return database; }
+};
+
+/**
+ * Returns the number of targets from a few starts whose extracted path lengths differ from Dijkstra
+ */
+std::size_t count_mismatches(const DatabaseGraph& database_graph, const std::vector<bench::Query>& queries, std::size_t limit)
+{
+  std::size_t mismatches = 0;
+  DistanceTree tree;
+  demo::v3_cpd::TerminateAtGoal ctx;
+  std::vector<vertex_id_t> path;
+  for (std::size_t i = 0; i < std::min(queries.size(), limit); ++i)
+  {
+    const vertex_id_t s = queries[i].start;
+    search(tree, database_graph, s);
+    for (vertex_id_t t = 0; t < database_graph.vertex_count(); ++t)
+    {
+      ctx.set_goal(t);
+      if (!search(ctx, database_graph, s))
+      {
+        mismatches += tree.is_visited(t);
+        continue;
+      }
+
+      path.clear();
+      get_reverse_path(std::back_inserter(path), ctx, t);
+      mismatches += (bench::reverse_path_length(database_graph, path) != tree.distance(t));
+    }
+  }
+  return mismatches;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<seed>] [<database_file>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 100000;
+  const std::size_t seed = (argc > 3) ? std::stoul(argv[3]) : 1;
+  const std::filesystem::path database_file_name = (argc > 4) ? std::filesystem::path{argv[4]} : std::filesystem::temp_directory_path() / "bench_path_database.cpd";
+
+  demo::v3_csr::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  const std::size_t thread_count = demo::default_thread_count();
+  const bench::Stopwatch build_stopwatch;
+  const demo::v3_cpd::PathDatabase built{graph.view(), thread_count};
+  std::cout << "Built path database for " << graph.vertex_count() <<
+               " vertices with " << thread_count <<
+               " thread(s) in " << build_stopwatch.elapsed_seconds() <<
+               " s, runs per row: " << (static_cast<double>(built.run_count()) / graph.vertex_count()) <<
+               ", memory: " << (built.memory_bytes() >> 10) << " KiB" << std::endl;
+
+  const bench::Stopwatch save_stopwatch;
+  built.save(database_file_name);
+  const double save_seconds = save_stopwatch.elapsed_seconds();
+  const bench::Stopwatch map_stopwatch;
+  const demo::v3_cpd::PathDatabase database{database_file_name};
+  if (!database.is_built_for(graph.view()))
+  {
+    std::cerr << "Mapped path database does not match the graph it was built from" << std::endl;
+    return 1;
+  }
+  std::cout << "Saved in " << (1e3 * save_seconds) <<
+               " ms, mapped in " << (1e3 * map_stopwatch.elapsed_seconds()) << " ms" << std::endl;
+
+  const DatabaseGraph database_graph{graph, database};
+  const auto queries = bench::make_random_queries(graph.vertex_count(), query_count, seed);
+
+  {
+    demo::v3_cpd::TerminateAtGoal ctx;
+    std::vector<vertex_id_t> path;
+    std::size_t solved = 0;
+    std::size_t path_vertices = 0;
+    const bench::Stopwatch stopwatch;
+    for (const auto& q : queries)
+    {
+      ctx.set_goal(q.goal);
+      if (search(ctx, database_graph, q.start))
+      {
+        path.clear();
+        get_reverse_path(std::back_inserter(path), ctx, q.goal);
+        path_vertices += path.size();
+        ++solved;
+      }
+    }
+    const double seconds = stopwatch.elapsed_seconds();
+    std::cout << "Extracted " << solved <<
+                 " of " << queries.size() <<
+                 " paths in " << (1e6 * seconds / queries.size()) <<
+                 " us/query, " << (1e9 * seconds / std::max<std::size_t>(1, path_vertices)) <<
+                 " ns/vertex, length mismatches against Dijkstra: " << count_mismatches(database_graph, queries, 20) << std::endl;
+  }
+
+  {
+    demo::v3::TerminateAtGoal ctx;
+    const auto stats = bench::run_queries(ctx, graph, queries);
+    std::cout << "Dijkstra solved " << stats.solved <<
+                 " of " << queries.size() <<
+                 " in " << (1e6 * stats.seconds / queries.size()) << " us/query" << std::endl;
+  }
+
+  std::filesystem::remove(database_file_name);
+  return 0;
+}
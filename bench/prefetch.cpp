@@ -0,0 +1,105 @@
+// C++ Standard Library
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+// CppCon
+#include <cppcon/prefetch.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/a3/context.h>
+#include <cppcon/demo/a3/graph.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+using namespace cppcon;
+
+template<typename C, SearchGraph G>
+void report(std::string_view filter, const char* name, const G& graph, const std::vector<bench::Query>& queries, bench::PathChecksum& expected)
+{
+  if (filter != "all" and filter != name)
+  {
+    return;
+  }
+
+  C ctx;
+  bench::PathChecksum checksum;
+  bench::PerfCounters counters;
+
+  counters.start();
+  const bench::Stopwatch stopwatch;
+  for (const auto& q : queries)
+  {
+    ctx.set_goal(q.goal);
+    checksum.add(ctx, q.goal, search(ctx, graph, q.start));
+  }
+  const double seconds = stopwatch.elapsed_seconds();
+  const auto counts = counters.stop();
+
+  // The first variant of each family is its baseline
+  if (expected.solved == 0)
+  {
+    expected = checksum;
+  }
+
+  std::cout << name << ": " << (1e6 * seconds / queries.size()) << " us/query";
+  for (std::size_t e = 0; e < bench::PerfCounters::kEventCount; ++e)
+  {
+    if (counts[e])
+    {
+      std::cout << ", " << bench::PerfCounters::name(static_cast<bench::PerfCounters::Event>(e)) << "/query " << (*counts[e] / queries.size());
+    }
+  }
+  if (counts[bench::PerfCounters::kCycles] and counts[bench::PerfCounters::kInstructions])
+  {
+    std::cout << ", IPC " << (static_cast<double>(*counts[bench::PerfCounters::kInstructions]) / *counts[bench::PerfCounters::kCycles]);
+  }
+  std::cout << ((checksum == expected) ? "" : " (RESULTS DIFFER)") << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<ordering: identity|hilbert|rcm|bfs|dfs|random>] [<variant: all|name>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 1000;
+  const auto ordering = (argc > 3) ? demo::to_ordering(argv[3]).value_or(demo::Ordering::kHilbert) : demo::Ordering::kHilbert;
+  const std::string_view filter = (argc > 4) ? argv[4] : "all";
+  const std::size_t seed = (argc > 5) ? std::stoul(argv[5]) : 1;
+
+  if (bench::PerfCounters{}.unavailable())
+  {
+    std::cout << "Hardware counters are unavailable; run one variant at a time under cachegrind instead, e.g." << std::endl <<
+                 "  valgrind --tool=cachegrind --cache-sim=yes " << argv[0] << " <graph_json> 100 " << to_string(ordering) << " v3/lookahead-3" << std::endl;
+  }
+
+  demo::v3::Graph v3_graph{argv[1]};
+  const auto permutation = demo::make_permutation(v3_graph, ordering, seed);
+  v3_graph.shuffle(permutation.indices());
+
+  demo::v3_csr::Graph v3_csr_graph{argv[1]};
+  v3_csr_graph.shuffle(permutation.indices());
+
+  demo::a3::Graph a3_graph{argv[1]};
+  a3_graph.shuffle(permutation.indices());
+
+  const auto queries = bench::make_random_queries(v3_graph.vertex_count(), query_count, seed);
+
+  bench::PathChecksum v3_expected;
+  report<demo::v3::TerminateAtGoal>(filter, "v3", v3_graph, queries, v3_expected);
+  report<demo::v3::BasicTerminateAtGoal<HeapTopPrefetch<1>>>(filter, "v3/lookahead-1", v3_graph, queries, v3_expected);
+  report<demo::v3::BasicTerminateAtGoal<HeapTopPrefetch<3>>>(filter, "v3/lookahead-3", v3_graph, queries, v3_expected);
+  report<demo::v3::BasicTerminateAtGoal<HeapTopPrefetch<7>>>(filter, "v3/lookahead-7", v3_graph, queries, v3_expected);
+  report<demo::v3::TerminateAtGoal>(filter, "v3_csr", v3_csr_graph, queries, v3_expected);
+  report<demo::v3::BasicTerminateAtGoal<HeapTopPrefetch<3>>>(filter, "v3_csr/lookahead-3", v3_csr_graph, queries, v3_expected);
+
+  bench::PathChecksum a3_expected;
+  report<demo::a3::TerminateAtGoal>(filter, "a3", a3_graph, queries, a3_expected);
+  report<demo::a3::BasicTerminateAtGoal<HeapTopPrefetch<3>>>(filter, "a3/lookahead-3", a3_graph, queries, a3_expected);
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+// C++ Standard Library
+#include <iostream>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v5/context.h>
+
+using namespace cppcon;
+
+/**
+ * v3::TerminateAtGoal which counts queue operations, for comparison with v5 contexts
+ */
+class CountingTerminateAtGoal : public demo::v3::TerminateAtGoal
+{
+public:
+  template<SearchGraph G>
+  void reset(G&& graph, vertex_id_t s)
+  {
+    queue_size_ = 0;
+    demo::v3::TerminateAtGoal::reset(graph, s);
+    count_push();
+  }
+
+  Transition dequeue()
+  {
+    --queue_size_;
+    ++stats_.pops;
+    return demo::v3::TerminateAtGoal::dequeue();
+  }
+
+  void enqueue(vertex_id_t p, vertex_id_t s, edge_weight_t w)
+  {
+    count_push();
+    demo::v3::TerminateAtGoal::enqueue(p, s, w);
+  }
+
+  const demo::v5::QueueStats& stats() const { return stats_; }
+
+private:
+  void count_push()
+  {
+    ++stats_.pushes;
+    stats_.peak_size = std::max(stats_.peak_size, ++queue_size_);
+  }
+
+  std::size_t queue_size_ = 0;
+  demo::v5::QueueStats stats_;
+};
+
+template<typename C>
+void report(const char* name, const demo::v3::Graph& graph, const std::vector<bench::Query>& queries)
+{
+  C ctx;
+  const auto result = bench::run_queries(ctx, graph, queries);
+  const auto& stats = ctx.stats();
+  std::cout << name <<
+               ": solved " << result.solved <<
+               " of " << queries.size() <<
+               " in " << result.seconds <<
+               " s, pushes: " << stats.pushes <<
+               ", decrease-keys: " << stats.decrease_keys <<
+               ", pops: " << stats.pops <<
+               ", peak queue size: " << stats.peak_size << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  demo::v3::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  const auto queries = bench::make_random_queries(
+    graph.vertex_count(),
+    (argc > 2) ? std::stoul(argv[2]) : 1000,
+    (argc > 3) ? std::stoul(argv[3]) : 1);
+
+  report<CountingTerminateAtGoal>("v3 (binary heap, lazy deletion)", graph, queries);
+  report<demo::v5::BasicTerminateAtGoal<4>>("v5 (indexed 4-ary heap)", graph, queries);
+  report<demo::v5::BasicTerminateAtGoal<8>>("v5 (indexed 8-ary heap)", graph, queries);
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+// C++ Standard Library
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+// CppCon
+#include <cppcon/search_session.h>
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v4/context.h>
+#include <cppcon/demo/v5/context.h>
+
+using namespace cppcon;
+
+/**
+ * Route of several pick locations, all planned from the same start
+ */
+struct Route
+{
+  vertex_id_t start;
+  std::vector<vertex_id_t> goals;
+};
+
+template<typename C>
+void report(const char* name, const demo::v3::Graph& graph, const std::vector<Route>& routes)
+{
+  C ctx;
+
+  std::size_t restarted_solved = 0;
+  const bench::Stopwatch restarted_stopwatch;
+  for (const auto& route : routes)
+  {
+    for (const auto goal : route.goals)
+    {
+      ctx.set_goal(goal);
+      restarted_solved += search(ctx, graph, route.start);
+    }
+  }
+  const double restarted_seconds = restarted_stopwatch.elapsed_seconds();
+
+  std::size_t resumed_solved = 0;
+  SearchSession session{ctx, graph};
+  const bench::Stopwatch resumed_stopwatch;
+  for (const auto& route : routes)
+  {
+    session.start(route.start);
+    for (const auto goal : route.goals)
+    {
+      resumed_solved += session.find(goal);
+    }
+  }
+  const double resumed_seconds = resumed_stopwatch.elapsed_seconds();
+
+  std::cout << name <<
+               ": search() per goal " << restarted_seconds <<
+               " s (" << restarted_solved <<
+               " solved), session " << resumed_seconds <<
+               " s (" << resumed_solved <<
+               " solved)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<route_count>] [<goals_per_route>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t route_count = (argc > 2) ? std::stoul(argv[2]) : 100;
+  const std::size_t goals_per_route = (argc > 3) ? std::stoul(argv[3]) : 10;
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  demo::v3::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  std::mt19937 rng{static_cast<std::mt19937::result_type>(seed)};
+  std::uniform_int_distribution<vertex_id_t> dist{0, static_cast<vertex_id_t>(graph.vertex_count() - 1)};
+  std::vector<Route> routes(route_count);
+  for (auto& route : routes)
+  {
+    route.start = dist(rng);
+    route.goals.resize(goals_per_route);
+    std::generate(route.goals.begin(), route.goals.end(), [&] { return dist(rng); });
+  }
+
+  std::cout << route_count << " routes of " << goals_per_route << " goals" << std::endl;
+  report<demo::v3::TerminateAtGoal>("v3", graph, routes);
+  report<demo::v4::TerminateAtGoal>("v4", graph, routes);
+  report<demo::v5::TerminateAtGoal>("v5", graph, routes);
+
+  return 0;
+}
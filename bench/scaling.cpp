@@ -0,0 +1,134 @@
+// C++ Standard Library
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/parallel.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/run.h>
+#include <cppcon/demo/topology.h>
+#include <cppcon/demo/a3/context.h>
+#include <cppcon/demo/a3/graph.h>
+#include <cppcon/demo/a4/context.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v3_csr/graph.h>
+#include <cppcon/demo/v4/context.h>
+#include <cppcon/demo/v5/context.h>
+
+using namespace cppcon;
+
+/// Queries per task; small enough to balance, large enough that taking a task costs nothing in comparison
+constexpr std::size_t kQueriesPerTask = 16;
+
+/**
+ * Solves every query on \c thread_count workers pinned as by demo::run, each with its own context
+ */
+template<typename C, SearchGraph G>
+  requires demo::Searchable<C, G>
+bench::QueryStats run_parallel(const G& graph, const std::vector<bench::Query>& queries, const std::vector<int>& cpus, std::size_t thread_count)
+{
+  std::vector<C> contexts(thread_count);
+  std::vector<std::size_t> solved(thread_count, 0);
+
+  const bench::Stopwatch stopwatch;
+  demo::parallel_for_stealing(
+    (queries.size() + kQueriesPerTask - 1) / kQueriesPerTask,
+    thread_count,
+    [&](std::size_t task, std::size_t w)
+    {
+      auto& ctx = contexts[w];
+      for (std::size_t i = task * kQueriesPerTask; i < std::min(queries.size(), (task + 1) * kQueriesPerTask); ++i)
+      {
+        ctx.set_goal(queries[i].goal);
+        solved[w] += search(ctx, graph, queries[i].start);
+      }
+    },
+    [&cpus](std::size_t w)
+    {
+      if (w > 0)
+      {
+        demo::pin_current_thread(cpus[w % cpus.size()]);
+      }
+    });
+
+  bench::QueryStats stats;
+  stats.seconds = stopwatch.elapsed_seconds();
+  for (const std::size_t n : solved)
+  {
+    stats.solved += n;
+  }
+  return stats;
+}
+
+template<typename C, SearchGraph G>
+void report(const char* name, const G& graph, const std::vector<bench::Query>& queries, const std::vector<int>& cpus, const std::vector<std::size_t>& thread_counts)
+{
+  double serial_rate = 0.0;
+  for (const std::size_t thread_count : thread_counts)
+  {
+    const auto stats = run_parallel<C>(graph, queries, cpus, thread_count);
+    const double rate = queries.size() / stats.seconds;
+    serial_rate = (thread_count == 1) ? rate : serial_rate;
+    std::cout << name <<
+                 ", " << thread_count <<
+                 " thread(s): solved " << stats.solved <<
+                 " of " << queries.size() <<
+                 ", " << rate <<
+                 " queries/s, speedup " << (rate / serial_rate) <<
+                 ", efficiency " << (100.0 * rate / serial_rate / thread_count) << "%" << std::endl;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<max_threads>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const auto cpus = demo::worker_cpu_order();
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 1000;
+  const std::size_t max_threads = (argc > 3) ? std::stoul(argv[3]) : cpus.size();
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  // Doubling up to, and always including, the largest thread count
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t n = 1; n < max_threads; n *= 2)
+  {
+    thread_counts.push_back(n);
+  }
+  thread_counts.push_back(std::max<std::size_t>(1, max_threads));
+
+  std::cout << "Worker CPUs in pinning order:";
+  for (const int cpu : cpus)
+  {
+    std::cout << ' ' << cpu;
+  }
+  std::cout << std::endl;
+
+  demo::v3::Graph v3_graph{argv[1]};
+  const auto permutation = demo::make_permutation(v3_graph, demo::Ordering::kHilbert);
+  v3_graph.shuffle(permutation.indices());
+
+  demo::v3_csr::Graph v3_csr_graph{argv[1]};
+  v3_csr_graph.shuffle(permutation.indices());
+
+  demo::a3::Graph a3_graph{argv[1]};
+  a3_graph.shuffle(permutation.indices());
+
+  const auto queries = bench::make_random_queries(v3_graph.vertex_count(), query_count, seed);
+
+  report<demo::v3::TerminateAtGoal>("v3", v3_graph, queries, cpus, thread_counts);
+  report<demo::v3::TerminateAtGoal>("v3_csr", v3_csr_graph, queries, cpus, thread_counts);
+  report<demo::v4::TerminateAtGoal>("v4", v3_graph, queries, cpus, thread_counts);
+  report<demo::v5::TerminateAtGoal>("v5", v3_graph, queries, cpus, thread_counts);
+  report<demo::a3::TerminateAtGoal>("a3", a3_graph, queries, cpus, thread_counts);
+  report<demo::a4::BasicTerminateAtGoal<demo::a3::Graph>>("a4", a3_graph, queries, cpus, thread_counts);
+
+  return 0;
+}
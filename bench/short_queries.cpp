@@ -0,0 +1,102 @@
+// C++ Standard Library
+#include <iostream>
+#include <random>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/a3/context.h>
+#include <cppcon/demo/a3/graph.h>
+#include <cppcon/demo/a4/context.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v4/context.h>
+#include <cppcon/demo/v5/context.h>
+
+using namespace cppcon;
+
+/**
+ * Returns queries whose goal is a random vertex exactly \c hops edges away from a random start
+ */
+template<SearchGraph G>
+std::vector<bench::Query> make_local_queries(const G& graph, std::size_t query_count, std::size_t hops, std::size_t seed)
+{
+  std::mt19937 rng{static_cast<std::mt19937::result_type>(seed)};
+  std::uniform_int_distribution<vertex_id_t> dist{0, static_cast<vertex_id_t>(graph.vertex_count() - 1)};
+
+  std::vector<bench::Query> queries;
+  std::vector<std::size_t> depth(graph.vertex_count());
+  std::vector<vertex_id_t> frontier;
+  while (queries.size() < query_count)
+  {
+    const vertex_id_t start = dist(rng);
+
+    std::fill(depth.begin(), depth.end(), std::numeric_limits<std::size_t>::max());
+    depth[start] = 0;
+    frontier.assign(1, start);
+    for (std::size_t head = 0; head < frontier.size() and depth[frontier[head]] < hops; ++head)
+    {
+      const vertex_id_t q = frontier[head];
+      graph.for_each_edge(
+        q,
+        [&](vertex_id_t child, const EdgeProperties&)
+        {
+          if (depth[child] == std::numeric_limits<std::size_t>::max())
+          {
+            depth[child] = depth[q] + 1;
+            frontier.push_back(child);
+          }
+        });
+    }
+
+    if (depth[frontier.back()] == hops)
+    {
+      const auto first = std::find_if(frontier.begin(), frontier.end(), [&](vertex_id_t q) { return depth[q] == hops; });
+      queries.push_back(bench::Query{.start = start, .goal = first[rng() % (frontier.end() - first)]});
+    }
+  }
+  return queries;
+}
+
+template<typename C, SearchGraph G>
+void report(const char* name, const G& graph, const std::vector<bench::Query>& queries)
+{
+  C ctx;
+  const auto stats = bench::run_queries(ctx, graph, queries);
+  std::cout << name <<
+               ": solved " << stats.solved <<
+               " of " << queries.size() <<
+               ", " << (1e6 * stats.seconds / queries.size()) <<
+               " us/query" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<hops>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 10000;
+  const std::size_t hops = (argc > 3) ? std::stoul(argv[3]) : 5;
+  const std::size_t seed = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+  demo::v3::Graph v3_graph{argv[1]};
+  const auto permutation = demo::make_permutation(v3_graph, demo::Ordering::kHilbert);
+  v3_graph.shuffle(permutation.indices());
+
+  demo::a3::Graph a3_graph{argv[1]};
+  a3_graph.shuffle(permutation.indices());
+
+  const auto queries = make_local_queries(v3_graph, query_count, hops, seed);
+
+  std::cout << v3_graph.vertex_count() << " vertices, goals " << hops << " hops from start" << std::endl;
+  report<demo::v3::TerminateAtGoal>("v3 (O(V) reset)", v3_graph, queries);
+  report<demo::v4::TerminateAtGoal>("v4 (epoch reset, radix heap)", v3_graph, queries);
+  report<demo::v5::TerminateAtGoal>("v5 (epoch reset, indexed heap)", v3_graph, queries);
+  report<demo::a3::TerminateAtGoal>("a3 (O(V) reset and heuristic)", a3_graph, queries);
+  report<demo::a4::BasicTerminateAtGoal<demo::a3::Graph>>("a4 (epoch reset, lazy heuristic)", a3_graph, queries);
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+// C++ Standard Library
+#include <iostream>
+#include <ranges>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/graph.h>
+
+using namespace cppcon;
+
+/**
+ * Adjacency storage of v3::Graph, re-ordered the way v3::Graph::shuffle did before it was parallelized
+ */
+struct LegacyAdjacency
+{
+  std::vector<std::ranges::subrange<const Edge*>> adjacencies;
+  std::vector<Edge> edges;
+
+  template<SearchGraph G>
+  explicit LegacyAdjacency(const G& graph)
+  {
+    std::vector<std::size_t> degrees(graph.vertex_count(), 0);
+    for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+    {
+      graph.for_each_edge(
+        q,
+        [this, &degrees, q](vertex_id_t succ, const EdgeProperties& edge)
+        {
+          this->edges.emplace_back(succ, edge);
+          ++degrees[q];
+        });
+    }
+    std::size_t idx = 0;
+    for (const auto degree : degrees)
+    {
+      this->adjacencies.emplace_back(this->edges.data() + idx, this->edges.data() + idx + degree);
+      idx += degree;
+    }
+  }
+
+  void shuffle(const std::vector<std::size_t>& indices)
+  {
+    std::vector<std::vector<Edge>> collated_adjacencies;
+    collated_adjacencies.resize(this->adjacencies.size());
+    for (vertex_id_t pred = 0; pred < this->adjacencies.size(); ++pred)
+    {
+      const auto& edges = this->adjacencies[pred];
+      collated_adjacencies[pred] = std::vector<Edge>{edges.begin(), edges.end()};
+    }
+
+    std::vector<std::vector<Edge>> shuffled_adjacencies;
+    shuffled_adjacencies.resize(this->adjacencies.size());
+    for (vertex_id_t pred = 0; pred < this->adjacencies.size(); ++pred)
+    {
+      auto& shuffled = shuffled_adjacencies[indices[pred]];
+      shuffled.swap(collated_adjacencies[pred]);
+      for (auto& [succ, _] : shuffled)
+      {
+        succ = indices[succ];
+      }
+    }
+
+    this->edges.clear();
+    this->adjacencies.clear();
+    std::size_t idx = 0;
+    for (const auto& e : shuffled_adjacencies)
+    {
+      std::size_t idx_start = idx;
+      for (const auto& edge : e)
+      {
+        this->edges.emplace_back(edge);
+        ++idx;
+      }
+      this->adjacencies.emplace_back(this->edges.data() + idx_start, this->edges.data() + idx);
+    }
+  }
+};
+
+template<SearchGraph G>
+bool is_same_adjacency(const G& graph, const LegacyAdjacency& legacy)
+{
+  for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+  {
+    auto itr = legacy.adjacencies[q].begin();
+    bool same = true;
+    graph.for_each_edge(
+      q,
+      [&](vertex_id_t succ, const EdgeProperties& edge)
+      {
+        same = same and itr != legacy.adjacencies[q].end() and itr->first == succ and itr->second.weight == edge.weight;
+        ++itr;
+      });
+    if (!same or itr != legacy.adjacencies[q].end())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<repetitions>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t repetitions = (argc > 2) ? std::stoul(argv[2]) : 10;
+  const std::size_t seed = (argc > 3) ? std::stoul(argv[3]) : 1;
+
+  demo::v3::Graph graph{argv[1]};
+  LegacyAdjacency legacy{graph};
+
+  double t_legacy_secs = 0;
+  double t_parallel_secs = 0;
+  for (std::size_t r = 0; r < repetitions; ++r)
+  {
+    const auto permutation = demo::make_permutation(graph, demo::Ordering::kRandom, seed + r);
+    {
+      const bench::Stopwatch stopwatch;
+      legacy.shuffle(permutation.indices());
+      t_legacy_secs += stopwatch.elapsed_seconds();
+    }
+    {
+      const bench::Stopwatch stopwatch;
+      graph.shuffle(permutation.indices());
+      t_parallel_secs += stopwatch.elapsed_seconds();
+    }
+  }
+
+  std::cout << "per-vertex vectors (legacy): " << (t_legacy_secs / repetitions) << " s/shuffle" << std::endl;
+  std::cout << "count/scan/scatter (parallel): " << (t_parallel_secs / repetitions) << " s/shuffle" << std::endl;
+  std::cout << "results match: " << (is_same_adjacency(graph, legacy) ? "yes" : "NO") << std::endl;
+
+  return 0;
+}
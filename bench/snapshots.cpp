@@ -0,0 +1,230 @@
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+// CppCon
+#include <cppcon/bench/bench.h>
+#include <cppcon/demo/parallel.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3_csr/graph.h>
+#include <cppcon/demo/v3_csr/snapshot.h>
+
+using namespace cppcon;
+
+/**
+ * v3_csr::Graph behind a reader-writer lock, updated in place
+ */
+struct LockedGraph
+{
+  demo::v3_csr::Graph graph;
+  std::shared_mutex mutex;
+};
+
+/**
+ * Returns batches of random closures, re-openings and slow-downs of existing edges
+ */
+std::vector<std::vector<EdgeUpdate>> make_batches(const demo::v3_csr::Graph& graph, std::size_t batch_count, std::size_t batch_size, std::size_t seed)
+{
+  std::vector<EdgeUpdate> edges;
+  for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+  {
+    graph.for_each_edge(q, [&edges, q](vertex_id_t v, const EdgeProperties& edge) { edges.push_back(EdgeUpdate{q, v, edge}); });
+  }
+
+  std::mt19937 rng{static_cast<std::mt19937::result_type>(seed)};
+  std::uniform_int_distribution<std::size_t> random_edge{0, edges.size() - 1};
+  std::uniform_int_distribution<int> random_kind{0, 2};
+
+  std::vector<std::vector<EdgeUpdate>> batches(batch_count);
+  for (auto& batch : batches)
+  {
+    for (std::size_t i = 0; i < batch_size; ++i)
+    {
+      EdgeUpdate update = edges[random_edge(rng)];
+      switch (random_kind(rng))
+      {
+        case 0: update.edge.valid = false; break;
+        case 1: update.edge.weight *= 4; break;
+        default: break;
+      }
+      batch.push_back(update);
+    }
+  }
+  return batches;
+}
+
+struct RunStats
+{
+  std::vector<double> latencies;
+  std::size_t solved = 0;
+  std::size_t published = 0;
+  double publish_seconds = 0.0;
+  double seconds = 0.0;
+};
+
+/**
+ * Runs \c queries split across \c reader_count threads, while one writer publishes a batch every \c period
+ * until all readers are done
+ *
+ * \param query  fn(reader_index, ctx, query) which runs one query, returning true if a path was found
+ * \param publish  fn(batch) which publishes one batch
+ */
+template<typename QueryFnT, typename PublishFnT>
+RunStats run(
+  std::size_t reader_count,
+  const std::vector<bench::Query>& queries,
+  const std::vector<std::vector<EdgeUpdate>>& batches,
+  std::chrono::microseconds period,
+  QueryFnT query,
+  PublishFnT publish)
+{
+  RunStats stats;
+  std::vector<std::vector<double>> latencies(reader_count);
+  std::vector<std::size_t> solved(reader_count, 0);
+  std::atomic<std::size_t> running{reader_count};
+
+  const bench::Stopwatch stopwatch;
+  {
+    std::jthread writer{
+      [&]
+      {
+        for (auto next = std::chrono::steady_clock::now(); running.load() > 0 and !batches.empty(); )
+        {
+          next += period;
+          std::this_thread::sleep_until(next);
+          const bench::Stopwatch publish_stopwatch;
+          publish(batches[stats.published % batches.size()]);
+          stats.publish_seconds += publish_stopwatch.elapsed_seconds();
+          ++stats.published;
+        }
+      }};
+
+    std::vector<std::jthread> readers;
+    for (std::size_t r = 0; r < reader_count; ++r)
+    {
+      readers.emplace_back(
+        [&, r]
+        {
+          demo::v3::TerminateAtGoal ctx;
+          for (std::size_t i = r; i < queries.size(); i += reader_count)
+          {
+            const bench::Stopwatch query_stopwatch;
+            solved[r] += query(r, ctx, queries[i]);
+            latencies[r].push_back(query_stopwatch.elapsed_seconds());
+          }
+          --running;
+        });
+    }
+  }
+  stats.seconds = stopwatch.elapsed_seconds();
+
+  for (std::size_t r = 0; r < reader_count; ++r)
+  {
+    stats.latencies.insert(stats.latencies.end(), latencies[r].begin(), latencies[r].end());
+    stats.solved += solved[r];
+  }
+  std::sort(stats.latencies.begin(), stats.latencies.end());
+  return stats;
+}
+
+void report(const char* name, const RunStats& stats)
+{
+  const auto percentile = [&stats](double p) { return 1e3 * stats.latencies[static_cast<std::size_t>(p * (stats.latencies.size() - 1))]; };
+  std::cout << name <<
+               ": solved " << stats.solved <<
+               " of " << stats.latencies.size() <<
+               " in " << stats.seconds <<
+               " s, latency p50 " << percentile(0.5) <<
+               " ms, p99 " << percentile(0.99) <<
+               " ms, max " << percentile(1.0) <<
+               " ms; published " << stats.published <<
+               " batches at " << (1e6 * stats.publish_seconds / std::max<std::size_t>(1, stats.published)) << " us/batch" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << argv[0] << " <graph_json> [<query_count>] [<reader_count>] [<batches_per_second>] [<batch_size>] [<seed>]" << std::endl;
+    return 1;
+  }
+
+  const std::size_t query_count = (argc > 2) ? std::stoul(argv[2]) : 1000;
+  const std::size_t reader_count = (argc > 3) ? std::stoul(argv[3]) : demo::default_thread_count();
+  const std::size_t batches_per_second = (argc > 4) ? std::stoul(argv[4]) : 100;
+  const std::size_t batch_size = (argc > 5) ? std::stoul(argv[5]) : 100;
+  const std::size_t seed = (argc > 6) ? std::stoul(argv[6]) : 1;
+
+  demo::v3_csr::Graph graph{argv[1]};
+  graph.shuffle(demo::make_permutation(graph, demo::Ordering::kHilbert).indices());
+
+  const auto queries = bench::make_random_queries(graph.vertex_count(), query_count, seed);
+  const auto batches = make_batches(graph, 1000, batch_size, seed);
+  const std::chrono::microseconds period{1000000 / std::max<std::size_t>(1, batches_per_second)};
+
+  {
+    demo::v3_csr::SnapshotGraph snapshot_graph{graph, reader_count};
+    std::vector<demo::v3_csr::SnapshotGraph::Reader> snapshot_readers;
+    for (std::size_t r = 0; r < reader_count; ++r)
+    {
+      snapshot_readers.push_back(snapshot_graph.make_reader());
+    }
+
+    const auto query = [&snapshot_readers](std::size_t r, demo::v3::TerminateAtGoal& ctx, const bench::Query& q)
+    {
+      const auto pin = snapshot_readers[r].pin();
+      ctx.set_goal(q.goal);
+      return search(ctx, pin.graph(), q.start);
+    };
+
+    report("snapshot, no updates", run(reader_count, queries, {}, period, query, [](const auto&) {}));
+
+    const auto stats = run(
+      reader_count,
+      queries,
+      batches,
+      period,
+      query,
+      [&snapshot_graph](const std::vector<EdgeUpdate>& batch) { snapshot_graph.publish(batch); });
+    report("snapshot, with updates", stats);
+    std::cout << "  live blocks: " << snapshot_graph.live_block_count() <<
+                 " (" << snapshot_graph.block_count() <<
+                 " per version), retired versions not yet freed: " << snapshot_graph.retired_version_count();
+
+    // Readers have all unpinned, so whatever the last publish() retired can now go
+    snapshot_graph.collect();
+    std::cout << ", after collect(): " << snapshot_graph.retired_version_count() <<
+                 " (live blocks: " << snapshot_graph.live_block_count() << ")" << std::endl;
+  }
+
+  {
+    LockedGraph locked_graph{graph, {}};
+    report(
+      "shared_mutex, in place",
+      run(
+        reader_count,
+        queries,
+        batches,
+        period,
+        [&locked_graph](std::size_t, demo::v3::TerminateAtGoal& ctx, const bench::Query& q)
+        {
+          const std::shared_lock lock{locked_graph.mutex};
+          ctx.set_goal(q.goal);
+          return search(ctx, locked_graph.graph, q.start);
+        },
+        [&locked_graph](const std::vector<EdgeUpdate>& batch)
+        {
+          const std::unique_lock lock{locked_graph.mutex};
+          locked_graph.graph.update_edges(batch);
+        }));
+  }
+
+  return 0;
+}
@@ -0,0 +1,52 @@
+// C++ Standard Library
+#include <filesystem>
+#include <iostream>
+
+// CPPCon
+#include <cppcon/demo/csr.h>
+#include <cppcon/demo/graph_file.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+using namespace cppcon;
+
+int main(int argc, char** argv)
+{
+  // Random orderings depend on a seed, so only deterministic orderings may be stored
+  const auto ordering = (argc > 3) ? demo::to_ordering(argv[3]) : demo::Ordering::kHilbert;
+  if (argc < 2 or !ordering or *ordering == demo::Ordering::kRandom)
+  {
+    std::cerr << argv[0] << " <graph_json> [<graph_bin>] [<ordering: identity|hilbert|rcm|bfs|dfs>]" << std::endl;
+    return 1;
+  }
+
+  const std::filesystem::path graph_in_json{argv[1]};
+  const std::filesystem::path graph_out_bin = (argc > 2) ? std::filesystem::path{argv[2]} : std::filesystem::path{graph_in_json}.replace_extension(".bin");
+
+  const auto csr = demo::load_csr_from_json(graph_in_json);
+
+  // Store vertices in the ordering run_demo would apply, so that a mapped graph can be searched in place
+  const demo::v3_csr::GraphView input_graph{csr.vertices, csr.offsets, csr.edges};
+  const auto permutation = demo::make_permutation(input_graph, *ordering);
+  if (*ordering == demo::Ordering::kIdentity)
+  {
+    demo::write_graph_file(graph_out_bin, csr.vertices, csr.offsets, csr.edges);
+  }
+  else
+  {
+    std::vector<vertex_id_t> input_ids(csr.vertices.size());
+    for (std::size_t q = 0; q < input_ids.size(); ++q)
+    {
+      input_ids[q] = permutation.external(q);
+    }
+    const auto stored = demo::permute_csr(csr.vertices, csr.offsets, csr.edges, permutation.indices());
+    demo::write_graph_file(graph_out_bin, stored.vertices, stored.offsets, stored.edges, *ordering, input_ids);
+  }
+
+  std::cerr << "Wrote " << csr.vertices.size() <<
+               " vertices and " << csr.edges.size() <<
+               " edges in " << demo::to_string(*ordering) <<
+               " order --> " << graph_out_bin << std::endl;
+
+  return 0;
+}
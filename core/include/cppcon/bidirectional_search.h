@@ -0,0 +1,170 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/// Distance of vertices which have not been reached
+inline constexpr edge_weight_t kInfiniteDistance = std::numeric_limits<edge_weight_t>::max();
+
+enum class Direction
+{
+  kForward = 0,
+  kBackward = 1
+};
+
+constexpr Direction opposite(Direction direction)
+{
+  return (direction == Direction::kForward) ? Direction::kBackward : Direction::kForward;
+}
+
+/**
+ * Context holding a forward frontier from the start and a backward frontier from the goal
+ *
+ * Each direction keeps tentative distances from its own root and a queue ordered by key, where
+ * key_forward(q) = distance_forward(q) + potential(q) and key_backward(q) = distance_backward(q) - potential(q)
+ * for some consistent potential (zero for Dijkstra). The keys of both directions then add up to the length
+ * of a path through q, which is what makes the meet-in-the-middle stopping criterion valid.
+ */
+template <typename T>
+concept BidirectionalSearchContext =
+  requires(T&& ctx)
+  {
+      { ctx.goal() };
+      { ctx.reverse_graph() };
+      { ctx.is_queue_not_empty(Direction{}) };
+      { ctx.queue_size(Direction{}) };
+      { ctx.top_key(Direction{}) };
+      { ctx.dequeue(Direction{}) };
+      { ctx.is_visited(Direction{}, vertex_id_t{}) };
+      { ctx.mark_visited(Direction{}, vertex_id_t{}, vertex_id_t{}) };
+      { ctx.distance(Direction{}, vertex_id_t{}) };
+      { ctx.enqueue(Direction{}, vertex_id_t{}, vertex_id_t{}, edge_weight_t{}) };
+      { ctx.predecessor(Direction{}, vertex_id_t{}) };
+      { ctx.meet(vertex_id_t{}, edge_weight_t{}) };
+      { ctx.meeting_vertex() };
+      { ctx.meeting_length() };
+  };
+
+
+/**
+ * Searches from both ends at once, expanding whichever frontier is smaller
+ *
+ * The shortest path found so far is updated whenever an edge reaches a vertex labeled by the other
+ * direction. Searching stops once the smallest keys of both queues add up to at least its length, at which
+ * point no shorter path can exist.
+ *
+ * \return true if a path from \c start to the goal of \c ctx exists
+ */
+template<BidirectionalSearchContext C, SearchGraph G>
+bool search(C& ctx, const G& graph, vertex_id_t start)
+{
+  ctx.reset(graph, start);
+
+  if (start == ctx.goal())
+  {
+    ctx.meet(start, 0);
+    return true;
+  }
+
+  const auto expand_from = [&ctx](Direction direction, const auto& g, vertex_id_t q)
+  {
+    const edge_weight_t distance = ctx.distance(direction, q);
+    g.for_each_edge(
+      q,
+      [&ctx, direction, distance, parent=q](vertex_id_t child, const EdgeProperties& edge)
+      {
+        if (!edge.valid or ctx.is_visited(direction, child))
+        {
+          return;
+        }
+        else if (ctx.enqueue(direction, parent, child, distance + edge.weight))
+        {
+          // Child is labeled from both ends; this is a complete path
+          if (const auto other = ctx.distance(opposite(direction), child); other != kInfiniteDistance)
+          {
+            if (const edge_weight_t length = distance + edge.weight + other; length < ctx.meeting_length())
+            {
+              ctx.meet(child, length);
+            }
+          }
+        }
+      });
+  };
+
+  while (ctx.is_queue_not_empty(Direction::kForward) and ctx.is_queue_not_empty(Direction::kBackward))
+  {
+    // Meet-in-the-middle stopping criterion
+    if (ctx.top_key(Direction::kForward) + ctx.top_key(Direction::kBackward) >= ctx.meeting_length())
+    {
+      break;
+    }
+
+    const Direction direction =
+      (ctx.queue_size(Direction::kForward) <= ctx.queue_size(Direction::kBackward)) ? Direction::kForward : Direction::kBackward;
+
+    // De-queue the vertex with the next smallest key in this direction
+    const auto transition = ctx.dequeue(direction);
+    const vertex_id_t succ = transition.succ;
+
+    // Skip the vertex if it has been visited in this direction
+    if (ctx.is_visited(direction, succ))
+    {
+      continue;
+    }
+    else
+    {
+      ctx.mark_visited(direction, transition.pred, succ);
+    }
+
+    if (direction == Direction::kForward)
+    {
+      expand_from(direction, graph, succ);
+    }
+    else
+    {
+      expand_from(direction, ctx.reverse_graph(), succ);
+    }
+  }
+
+  return ctx.meeting_length() != kInfiniteDistance;
+}
+
+
+/**
+ * Writes the path found by a bidirectional search from the goal back to the start, as get_reverse_path does
+ */
+template<typename OutputIteratorT, BidirectionalSearchContext C>
+OutputIteratorT get_reverse_path(OutputIteratorT out, const C& ctx, [[maybe_unused]] vertex_id_t goal)
+{
+  // Backward predecessors lead from the meeting vertex toward the goal, so collect them to emit in reverse
+  std::vector<vertex_id_t> meeting_to_goal;
+  for (vertex_id_t q = ctx.meeting_vertex(); ; q = ctx.predecessor(Direction::kBackward, q))
+  {
+    meeting_to_goal.push_back(q);
+    if (ctx.predecessor(Direction::kBackward, q) == q)
+    {
+      break;
+    }
+  }
+  out = std::copy(meeting_to_goal.rbegin(), meeting_to_goal.rend() - 1, out);
+
+  for (vertex_id_t q = ctx.meeting_vertex(); ; q = ctx.predecessor(Direction::kForward, q))
+  {
+    (*out) = q;
+    if (ctx.predecessor(Direction::kForward, q) == q)
+    {
+      break;
+    }
+  }
+  return out;
+}
+
+}  // namespace cppcon
@@ -0,0 +1,648 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// CppCon
+#include <cppcon/epoch_array.h>
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Edge of a contraction hierarchy; either an original edge, or a shortcut over the vertex \c middle
+ */
+struct HierarchyArc
+{
+  static constexpr vertex_id_t kNoMiddle = std::numeric_limits<vertex_id_t>::max();
+
+  /// Other endpoint of the arc
+  vertex_id_t vertex;
+  edge_weight_t weight;
+  vertex_id_t middle;
+};
+
+/**
+ * Contraction hierarchy over a static search graph
+ *
+ * Vertices are contracted one at a time in order of increasing importance; contracting a vertex adds a
+ * shortcut between each pair of its remaining neighbours whose shortest path runs through it. Every shortest
+ * path in the original graph then has an equal-length counterpart which first only climbs in rank, then only
+ * descends, so that queries are answered by two small upward searches.
+ *
+ * Arcs are stored as two CSR arrays, indexed by rank rather than by vertex ID so that the upper levels of the
+ * hierarchy, which every query visits, are contiguous in memory: upward(r) lists arcs (r, s) and downward(r)
+ * lists arcs (s, r), each only towards ranks s above r. Arc endpoints and shortcut middles are ranks as well.
+ */
+class ContractionHierarchy
+{
+public:
+  ContractionHierarchy() = default;
+
+  /**
+   * Orders and contracts all vertices of \c graph
+   *
+   * \param witness_search_limit  maximum vertices settled by each witness search (a tenth of that while only
+   *                              estimating priorities); smaller limits contract faster but may add shortcuts
+   *                              which are not needed
+   */
+  template<SearchGraph G>
+  explicit ContractionHierarchy(const G& graph, std::size_t witness_search_limit = 500)
+  {
+    Contraction contraction{graph.vertex_count(), witness_search_limit};
+    for (vertex_id_t u = 0; u < graph.vertex_count(); ++u)
+    {
+      graph.for_each_edge(
+        u,
+        [&contraction, u](vertex_id_t v, const EdgeProperties& edge)
+        {
+          if (edge.valid and u != v)
+          {
+            contraction.add_arc(u, v, edge.weight, HierarchyArc::kNoMiddle);
+          }
+        });
+    }
+    contraction.run(rank_);
+
+    vertex_.resize(rank_.size());
+    for (vertex_id_t q = 0; q < rank_.size(); ++q)
+    {
+      vertex_[rank_[q]] = q;
+    }
+
+    // Every arc (original or shortcut) belongs to the lower-ranked of its endpoints
+    const auto for_each_ranked_arc = [&](auto&& visit)
+    {
+      contraction.for_each_arc(
+        [&](vertex_id_t u, const HierarchyArc& arc)
+        {
+          visit(
+            rank_[u],
+            HierarchyArc{
+              .vertex = rank_[arc.vertex],
+              .weight = arc.weight,
+              .middle = (arc.middle == HierarchyArc::kNoMiddle) ? arc.middle : rank_[arc.middle]});
+        });
+    };
+    build_csr(
+      upward_offsets_,
+      upward_,
+      rank_.size(),
+      [&](auto&& visit)
+      {
+        for_each_ranked_arc(
+          [&visit](vertex_id_t r, const HierarchyArc& arc)
+          {
+            if (arc.vertex > r)
+            {
+              visit(r, arc);
+            }
+          });
+      });
+    build_csr(
+      downward_offsets_,
+      downward_,
+      rank_.size(),
+      [&](auto&& visit)
+      {
+        for_each_ranked_arc(
+          [&visit](vertex_id_t r, const HierarchyArc& arc)
+          {
+            if (arc.vertex < r)
+            {
+              visit(arc.vertex, HierarchyArc{.vertex = r, .weight = arc.weight, .middle = arc.middle});
+            }
+          });
+      });
+  }
+
+  std::size_t vertex_count() const { return rank_.size(); }
+
+  /**
+   * Returns the position of vertex \c q in the contraction order
+   */
+  vertex_id_t rank(vertex_id_t q) const { return rank_[q]; }
+
+  /**
+   * Returns the vertex at position \c r in the contraction order
+   */
+  vertex_id_t vertex(vertex_id_t r) const { return vertex_[r]; }
+
+  /**
+   * Returns arcs (r, s) towards higher ranks s
+   */
+  std::span<const HierarchyArc> upward(vertex_id_t r) const
+  {
+    return {upward_.data() + upward_offsets_[r], upward_.data() + upward_offsets_[r + 1]};
+  }
+
+  /**
+   * Returns arcs (s, r) from higher ranks s; each arc's \c vertex is s
+   */
+  std::span<const HierarchyArc> downward(vertex_id_t r) const
+  {
+    return {downward_.data() + downward_offsets_[r], downward_.data() + downward_offsets_[r + 1]};
+  }
+
+  std::size_t arc_count() const { return upward_.size() + downward_.size(); }
+
+  /**
+   * Relabels vertices, such that vertex q becomes vertex indices[q], as Graph::shuffle does
+   */
+  void shuffle(const std::vector<std::size_t>& indices)
+  {
+    // Arcs are stored by rank, so only the mapping between ranks and vertices changes
+    std::vector<vertex_id_t> rank(rank_.size());
+    for (std::size_t q = 0; q < rank_.size(); ++q)
+    {
+      rank[indices[q]] = rank_[q];
+      vertex_[rank_[q]] = indices[q];
+    }
+    rank_ = std::move(rank);
+  }
+
+  /**
+   * Writes the original vertices of the arc between ranks (u, w) from \c w back to, but excluding, \c u
+   */
+  template<typename OutputIteratorT>
+  OutputIteratorT unpack_reverse(OutputIteratorT out, vertex_id_t u, vertex_id_t w, vertex_id_t middle) const
+  {
+    if (middle == HierarchyArc::kNoMiddle)
+    {
+      (*out) = vertex_[w];
+      return out;
+    }
+
+    // Both halves of a shortcut lead down to the lower-ranked middle
+    out = unpack_reverse(out, middle, w, find_arc(upward(middle), w).middle);
+    return unpack_reverse(out, u, middle, find_arc(downward(middle), u).middle);
+  }
+
+private:
+  /**
+   * Returns the arc to \c v; every shortcut has arcs to both ends from its middle, so one not being found
+   * means the hierarchy is corrupt
+   */
+  static const HierarchyArc& find_arc(std::span<const HierarchyArc> arcs, vertex_id_t v)
+  {
+    const auto itr = std::find_if(arcs.begin(), arcs.end(), [v](const HierarchyArc& arc) { return arc.vertex == v; });
+    if (itr == arcs.end())
+    {
+      throw std::logic_error{"contraction hierarchy has a shortcut without an arc from its middle vertex"};
+    }
+    return *itr;
+  }
+
+  /**
+   * Fills CSR arrays with the arcs which \c for_each_arc passes to visit(source, arc); it is called twice
+   */
+  template<typename ForEachArcFnT>
+  static void build_csr(std::vector<std::size_t>& offsets, std::vector<HierarchyArc>& arcs, std::size_t n, ForEachArcFnT&& for_each_arc)
+  {
+    offsets.assign(n + 1, 0);
+    for_each_arc([&offsets](std::size_t q, const HierarchyArc&) { ++offsets[q + 1]; });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<std::size_t> cursor{offsets.begin(), offsets.end() - 1};
+    arcs.resize(offsets.back());
+    for_each_arc([&cursor, &arcs](std::size_t q, const HierarchyArc& arc) { arcs[cursor[q]++] = arc; });
+  }
+
+  /**
+   * Working state of the contraction: adjacency between remaining vertices, which grows with shortcuts, and
+   * the arcs of contracted vertices, which are final
+   */
+  class Contraction
+  {
+  public:
+    Contraction(std::size_t vertex_count, std::size_t witness_search_limit) :
+      witness_search_limit_{witness_search_limit},
+      out_(vertex_count),
+      in_(vertex_count),
+      contracted_neighbours_(vertex_count, 0),
+      level_(vertex_count, 0)
+    {}
+
+    /**
+     * Calls visitor(u, arc) for every arc (u, arc.vertex) of the hierarchy, once all vertices are contracted
+     */
+    template<typename VisitorT>
+    void for_each_arc(VisitorT&& visitor) const
+    {
+      for (const auto& [u, arc] : finished_)
+      {
+        visitor(u, arc);
+      }
+    }
+
+    /**
+     * Adds the arc (u, v), or shortens it if it already exists
+     */
+    void add_arc(vertex_id_t u, vertex_id_t v, edge_weight_t weight, vertex_id_t middle)
+    {
+      const auto update = [](std::vector<HierarchyArc>& arcs, vertex_id_t other, edge_weight_t weight, vertex_id_t middle)
+      {
+        if (auto itr = std::find_if(arcs.begin(), arcs.end(), [other](const HierarchyArc& arc) { return arc.vertex == other; });
+            itr == arcs.end())
+        {
+          arcs.push_back(HierarchyArc{.vertex = other, .weight = weight, .middle = middle});
+        }
+        else if (weight < itr->weight)
+        {
+          itr->weight = weight;
+          itr->middle = middle;
+        }
+      };
+      update(out_[u], v, weight, middle);
+      update(in_[v], u, weight, middle);
+    }
+
+    /**
+     * Contracts all vertices, lowest priority first, and writes the order in which they were contracted
+     */
+    void run(std::vector<vertex_id_t>& rank)
+    {
+      using Candidate = std::pair<std::int64_t, vertex_id_t>;
+      std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+      for (vertex_id_t v = 0; v < out_.size(); ++v)
+      {
+        queue.emplace(priority(v), v);
+      }
+
+      rank.assign(out_.size(), 0);
+      vertex_id_t next_rank = 0;
+      while (!queue.empty())
+      {
+        const vertex_id_t v = queue.top().second;
+        queue.pop();
+
+        // Priorities of the remaining vertices change as their neighbours are contracted; re-check lazily
+        if (const auto p = priority(v); !queue.empty() and p > queue.top().first)
+        {
+          queue.emplace(p, v);
+          continue;
+        }
+
+        contract(v, true);
+        rank[v] = next_rank++;
+        remove(v);
+      }
+    }
+
+  private:
+    /**
+     * Edge difference, plus terms which spread contraction evenly and keep the hierarchy shallow
+     */
+    std::int64_t priority(vertex_id_t v)
+    {
+      const auto removed = static_cast<std::int64_t>(out_[v].size() + in_[v].size());
+      const auto added = static_cast<std::int64_t>(contract(v, false));
+      return 2 * (added - removed) + contracted_neighbours_[v] + level_[v];
+    }
+
+    /**
+     * Moves the arcs of a contracted vertex from the remaining graph to the finished hierarchy
+     */
+    void remove(vertex_id_t v)
+    {
+      const auto erase = [v](std::vector<HierarchyArc>& arcs)
+      {
+        arcs.erase(std::find_if(arcs.begin(), arcs.end(), [v](const HierarchyArc& arc) { return arc.vertex == v; }));
+      };
+      const auto update_neighbour = [this, v](vertex_id_t q)
+      {
+        ++contracted_neighbours_[q];
+        level_[q] = std::max(level_[q], level_[v] + 1);
+      };
+
+      for (const auto& arc : out_[v])
+      {
+        finished_.emplace_back(v, arc);
+        erase(in_[arc.vertex]);
+        update_neighbour(arc.vertex);
+      }
+      for (const auto& arc : in_[v])
+      {
+        finished_.emplace_back(arc.vertex, HierarchyArc{.vertex = v, .weight = arc.weight, .middle = arc.middle});
+        erase(out_[arc.vertex]);
+        update_neighbour(arc.vertex);
+      }
+      out_[v] = {};
+      in_[v] = {};
+    }
+
+    /**
+     * Returns the number of shortcuts needed to contract \c v; adds them if \c apply is set
+     */
+    std::size_t contract(vertex_id_t v, bool apply)
+    {
+      // Arcs are copied, since adding shortcuts may grow the adjacency of v's neighbours
+      const std::vector<HierarchyArc> in_arcs = in_[v];
+      const std::vector<HierarchyArc> out_arcs = out_[v];
+
+      witness_target_.reset(out_.size(), false);
+      for (const auto& out_arc : out_arcs)
+      {
+        witness_target_.set(out_arc.vertex, true);
+      }
+
+      std::size_t shortcut_count = 0;
+      for (const auto& in_arc : in_arcs)
+      {
+        edge_weight_t max_length = 0;
+        for (const auto& out_arc : out_arcs)
+        {
+          if (out_arc.vertex != in_arc.vertex)
+          {
+            max_length = std::max(max_length, in_arc.weight + out_arc.weight);
+          }
+        }
+        if (max_length == 0)
+        {
+          continue;
+        }
+
+        witness_search(in_arc.vertex, v, max_length, out_arcs.size(), apply ? witness_search_limit_ : witness_search_limit_ / 10);
+
+        for (const auto& out_arc : out_arcs)
+        {
+          if (out_arc.vertex == in_arc.vertex)
+          {
+            continue;
+          }
+          else if (const edge_weight_t length = in_arc.weight + out_arc.weight; witness_.get(out_arc.vertex) > length)
+          {
+            ++shortcut_count;
+            if (apply)
+            {
+              add_arc(in_arc.vertex, out_arc.vertex, length, v);
+            }
+          }
+        }
+      }
+      return shortcut_count;
+    }
+
+    /**
+     * Computes distances from \c source, avoiding \c excluded, until \c target_count targets are settled or
+     * distances exceed \c max_length
+     */
+    void witness_search(vertex_id_t source, vertex_id_t excluded, edge_weight_t max_length, std::size_t target_count, std::size_t settled_limit)
+    {
+      witness_.reset(out_.size(), std::numeric_limits<edge_weight_t>::max());
+      witness_queue_.underlying().clear();
+
+      witness_.set(source, 0);
+      witness_queue_.emplace(0, source);
+      for (std::size_t settled = 0; !witness_queue_.empty() and settled < settled_limit; ++settled)
+      {
+        const auto [distance, q] = witness_queue_.top();
+        witness_queue_.pop();
+        if (distance > witness_.get(q))
+        {
+          continue;
+        }
+        else if (distance > max_length or (witness_target_.get(q) and --target_count == 0))
+        {
+          break;
+        }
+
+        for (const auto& arc : out_[q])
+        {
+          if (arc.vertex == excluded)
+          {
+            continue;
+          }
+          else if (const edge_weight_t d = distance + arc.weight; d < witness_.get(arc.vertex))
+          {
+            witness_.set(arc.vertex, d);
+            witness_queue_.emplace(d, arc.vertex);
+          }
+        }
+      }
+    }
+
+    template<typename T>
+    struct MinQueue : std::priority_queue<T, std::vector<T>, std::greater<T>>
+    {
+      std::vector<T>& underlying() { return this->c; }
+    };
+
+    std::size_t witness_search_limit_;
+    std::vector<std::vector<HierarchyArc>> out_;
+    std::vector<std::vector<HierarchyArc>> in_;
+    std::vector<std::pair<vertex_id_t, HierarchyArc>> finished_;
+    std::vector<std::int64_t> contracted_neighbours_;
+    std::vector<std::int64_t> level_;
+    EpochArray<edge_weight_t> witness_;
+    EpochArray<bool> witness_target_;
+    MinQueue<std::pair<edge_weight_t, vertex_id_t>> witness_queue_;
+  };
+
+  std::vector<vertex_id_t> rank_;
+  std::vector<vertex_id_t> vertex_;
+  std::vector<std::size_t> upward_offsets_;
+  std::vector<HierarchyArc> upward_;
+  std::vector<std::size_t> downward_offsets_;
+  std::vector<HierarchyArc> downward_;
+};
+
+
+template <typename T>
+concept HierarchicalSearchGraph =
+  SearchGraph<T> and
+  requires(T&& g)
+  {
+      { g.hierarchy() } -> std::convertible_to<const ContractionHierarchy&>;
+  };
+
+
+/**
+ * Search context for contraction hierarchy queries
+ *
+ * Labels, predecessors and the meeting point are kept by rank; vertex IDs are only used at the interface.
+ */
+class HierarchyQuery
+{
+public:
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  vertex_id_t goal() const { return goal_; }
+
+  /**
+   * Returns the number of vertices settled by both directions of the last search
+   */
+  std::size_t settled_count() const { return settled_count_; }
+
+  /**
+   * Returns the length of the path found by the last search
+   */
+  edge_weight_t path_length() const { return meeting_length_; }
+
+private:
+  template<HierarchicalSearchGraph G>
+  friend bool search(HierarchyQuery& ctx, const G& graph, vertex_id_t start);
+
+  template<typename OutputIteratorT>
+  friend OutputIteratorT get_reverse_path(OutputIteratorT out, const HierarchyQuery& ctx, vertex_id_t goal);
+
+  static constexpr edge_weight_t kInfinite = std::numeric_limits<edge_weight_t>::max();
+
+  struct Label
+  {
+    edge_weight_t distance = kInfinite;
+    vertex_id_t predecessor = std::numeric_limits<vertex_id_t>::max();
+    vertex_id_t middle = HierarchyArc::kNoMiddle;
+  };
+
+  using Entry = std::pair<edge_weight_t, vertex_id_t>;
+
+  struct Side
+  {
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    EpochArray<Label> labels;
+    bool done;
+  };
+
+  const ContractionHierarchy* hierarchy_ = nullptr;
+  vertex_id_t goal_;
+  std::array<Side, 2> sides_;
+  vertex_id_t meeting_vertex_;
+  edge_weight_t meeting_length_ = kInfinite;
+  std::size_t settled_count_ = 0;
+};
+
+
+/**
+ * Runs an upward search from both \c start and the goal, alternating between them
+ *
+ * Each direction stops once its smallest queued distance is no shorter than the best path through any
+ * vertex settled by both; vertices which are reached more cheaply from a higher-ranked neighbour are not
+ * expanded (stall-on-demand).
+ */
+template<HierarchicalSearchGraph G>
+bool search(HierarchyQuery& ctx, const G& graph, vertex_id_t start)
+{
+  const ContractionHierarchy& hierarchy = graph.hierarchy();
+  ctx.hierarchy_ = &hierarchy;
+  ctx.meeting_vertex_ = hierarchy.rank(start);
+  ctx.meeting_length_ = HierarchyQuery::kInfinite;
+  ctx.settled_count_ = 0;
+
+  for (auto& side : ctx.sides_)
+  {
+    side.queue = {};
+    side.labels.reset(hierarchy.vertex_count(), HierarchyQuery::Label{});
+    side.done = false;
+  }
+
+  // Both searches run over ranks rather than vertex IDs
+  const std::array<vertex_id_t, 2> roots{hierarchy.rank(start), hierarchy.rank(ctx.goal_)};
+  for (std::size_t d = 0; d < 2; ++d)
+  {
+    ctx.sides_[d].labels.set(roots[d], HierarchyQuery::Label{.distance = 0, .predecessor = roots[d]});
+    ctx.sides_[d].queue.emplace(0, roots[d]);
+  }
+
+  for (std::size_t d = 0; !(ctx.sides_[0].done and ctx.sides_[1].done); d = 1 - d)
+  {
+    auto& side = ctx.sides_[d];
+    auto& other = ctx.sides_[1 - d];
+    if (side.done)
+    {
+      continue;
+    }
+    else if (side.queue.empty() or side.queue.top().first >= ctx.meeting_length_)
+    {
+      side.done = true;
+      continue;
+    }
+
+    const auto [distance, q] = side.queue.top();
+    side.queue.pop();
+    if (distance > side.labels.get(q).distance)
+    {
+      continue;
+    }
+    ++ctx.settled_count_;
+
+    if (const edge_weight_t other_distance = other.labels.get(q).distance;
+        other_distance != HierarchyQuery::kInfinite and distance + other_distance < ctx.meeting_length_)
+    {
+      ctx.meeting_vertex_ = q;
+      ctx.meeting_length_ = distance + other_distance;
+    }
+
+    // Forward searches climb upward arcs (q, v); backward searches climb downward arcs (v, q) in reverse
+    const auto climbing = (d == 0) ? hierarchy.upward(q) : hierarchy.downward(q);
+    const auto stalling = (d == 0) ? hierarchy.downward(q) : hierarchy.upward(q);
+
+    if (std::any_of(
+          stalling.begin(),
+          stalling.end(),
+          [&side, distance](const HierarchyArc& arc)
+          {
+            const edge_weight_t via = side.labels.get(arc.vertex).distance;
+            return via != HierarchyQuery::kInfinite and via + arc.weight < distance;
+          }))
+    {
+      continue;
+    }
+
+    for (const auto& arc : climbing)
+    {
+      if (const edge_weight_t d_next = distance + arc.weight; d_next < side.labels.get(arc.vertex).distance)
+      {
+        side.labels.set(arc.vertex, HierarchyQuery::Label{.distance = d_next, .predecessor = q, .middle = arc.middle});
+        side.queue.emplace(d_next, arc.vertex);
+      }
+    }
+  }
+
+  return ctx.meeting_length_ != HierarchyQuery::kInfinite;
+}
+
+
+/**
+ * Writes the path found by a hierarchy search from the goal back to the start, with all shortcuts unpacked
+ */
+template<typename OutputIteratorT>
+OutputIteratorT get_reverse_path(OutputIteratorT out, const HierarchyQuery& ctx, [[maybe_unused]] vertex_id_t goal)
+{
+  const auto& forward = ctx.sides_[0].labels;
+  const auto& backward = ctx.sides_[1].labels;
+
+  // Backward labels lead from the meeting vertex toward the goal, so collect them to emit in reverse
+  std::vector<vertex_id_t> meeting_to_goal{ctx.meeting_vertex_};
+  for (vertex_id_t q = ctx.meeting_vertex_; backward.get(q).predecessor != q; q = backward.get(q).predecessor)
+  {
+    meeting_to_goal.push_back(backward.get(q).predecessor);
+  }
+  for (std::size_t i = meeting_to_goal.size() - 1; i > 0; --i)
+  {
+    // Arc (meeting_to_goal[i - 1], meeting_to_goal[i]) in the original direction
+    out = ctx.hierarchy_->unpack_reverse(out, meeting_to_goal[i - 1], meeting_to_goal[i], backward.get(meeting_to_goal[i - 1]).middle);
+  }
+
+  vertex_id_t q = ctx.meeting_vertex_;
+  for (; forward.get(q).predecessor != q; q = forward.get(q).predecessor)
+  {
+    out = ctx.hierarchy_->unpack_reverse(out, forward.get(q).predecessor, q, forward.get(q).middle);
+  }
+  (*out) = ctx.hierarchy_->vertex(q);
+  return out;
+}
+
+}  // namespace cppcon
@@ -0,0 +1,655 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <barrier>
+#include <concepts>
+#include <iterator>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// CppCon
+#include <cppcon/epoch_array.h>
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Orders vertices by recursive bisection of their coordinates, placing each separator after both halves
+ *
+ * Each set is cut across one of its coordinate axes, at whichever balanced position needs the fewest separator
+ * vertices; the separator is the smaller of the two sets of vertices with an edge crossing the cut. Contracting vertices in this order keeps the fill-in of a
+ * planar-like graph small without looking at edge weights.
+ *
+ * \return vertices in contraction order
+ */
+template<SearchGraph G>
+std::vector<vertex_id_t> nested_dissection_order(const G& graph)
+{
+  static constexpr std::size_t kLeafSize = 4;
+
+  // Cuts are tried between 4/16 and 12/16 of each set along either axis
+  static constexpr std::size_t kMinCutSixteenths = 4;
+
+  const std::size_t n = graph.vertex_count();
+
+  std::vector<std::vector<vertex_id_t>> neighbours(n);
+  for (vertex_id_t u = 0; u < n; ++u)
+  {
+    graph.for_each_edge(
+      u,
+      [&neighbours, u](vertex_id_t v, const EdgeProperties&)
+      {
+        if (u != v)
+        {
+          neighbours[u].push_back(v);
+          neighbours[v].push_back(u);
+        }
+      });
+  }
+
+  std::vector<vertex_id_t> vertices(n);
+  std::iota(vertices.begin(), vertices.end(), 0);
+
+  std::vector<vertex_id_t> order;
+  order.reserve(n);
+
+  enum Side : std::uint8_t { kNone, kLower, kUpper, kSeparator };
+  std::vector<Side> side(n, kNone);
+
+  const auto dissect = [&](const auto& self, auto first, auto last) -> void
+  {
+    if (static_cast<std::size_t>(last - first) <= kLeafSize)
+    {
+      order.insert(order.end(), first, last);
+      return;
+    }
+
+    const auto sort_along = [&graph, first, last](bool along_x)
+    {
+      std::sort(
+        first,
+        last,
+        [&graph, along_x](vertex_id_t lhs, vertex_id_t rhs)
+        {
+          return along_x ? (graph.vertex(lhs).x < graph.vertex(rhs).x) : (graph.vertex(lhs).y < graph.vertex(rhs).y);
+        });
+    };
+
+    const auto is_boundary = [&neighbours, &side](vertex_id_t q, Side other)
+    {
+      return std::any_of(neighbours[q].begin(), neighbours[q].end(), [&side, other](vertex_id_t v) { return side[v] == other; });
+    };
+
+    // Marks both sides of a cut and returns the size of its smaller boundary, and whether that is the lower one
+    const auto cut = [&](auto middle)
+    {
+      std::for_each(first, middle, [&side](vertex_id_t q) { side[q] = kLower; });
+      std::for_each(middle, last, [&side](vertex_id_t q) { side[q] = kUpper; });
+      const auto lower = std::count_if(first, middle, [&](vertex_id_t q) { return is_boundary(q, kUpper); });
+      const auto upper = std::count_if(middle, last, [&](vertex_id_t q) { return is_boundary(q, kLower); });
+      return std::make_pair(std::min(lower, upper), lower <= upper);
+    };
+
+    // Try balanced cuts along both axes and keep the one with the smallest separator
+    const std::size_t size = last - first;
+    std::size_t best_size = std::numeric_limits<std::size_t>::max();
+    std::size_t best_offset = size / 2;
+    bool best_along_x = true;
+    for (const bool along_x : {true, false})
+    {
+      sort_along(along_x);
+      for (std::size_t k = kMinCutSixteenths; k <= 16 - kMinCutSixteenths; ++k)
+      {
+        if (const std::size_t separator_size = cut(first + size * k / 16).first; separator_size < best_size)
+        {
+          best_size = separator_size;
+          best_offset = size * k / 16;
+          best_along_x = along_x;
+        }
+      }
+    }
+
+    sort_along(best_along_x);
+    const auto middle = first + best_offset;
+    const bool separate_lower = cut(middle).second;
+    const auto [begin, end, other] = separate_lower ? std::make_tuple(first, middle, kUpper) : std::make_tuple(middle, last, kLower);
+
+    std::vector<vertex_id_t> separator;
+    std::copy_if(begin, end, std::back_inserter(separator), [&](vertex_id_t q) { return is_boundary(q, other); });
+    std::for_each(separator.begin(), separator.end(), [&side](vertex_id_t q) { side[q] = kSeparator; });
+
+    // Arrange as [lower \ separator, upper \ separator, separator]
+    const auto lower_end = std::stable_partition(first, last, [&side](vertex_id_t q) { return side[q] == kLower; });
+    const auto upper_end = std::stable_partition(lower_end, last, [&side](vertex_id_t q) { return side[q] == kUpper; });
+    std::for_each(first, last, [&side](vertex_id_t q) { side[q] = kNone; });
+
+    self(self, first, lower_end);
+    self(self, lower_end, upper_end);
+    order.insert(order.end(), upper_end, last);
+  };
+  dissect(dissect, vertices.begin(), vertices.end());
+
+  return order;
+}
+
+
+/**
+ * Contraction hierarchy whose structure does not depend on edge weights
+ *
+ * Preprocessing orders vertices by nested dissection and contracts them without witness searches, which
+ * yields a chordal supergraph of the (undirected) input graph. Customization then computes the weights of
+ * all its arcs from the current edge weights by processing the lower triangles of each arc; vertices whose
+ * lower neighbours are all customized are processed in parallel. Re-customizing after weights change is
+ * therefore much cheaper than contracting again.
+ *
+ * As in ContractionHierarchy, arcs are stored by rank: arc (r, s) with r < s carries the weight from r to
+ * s (up) and from s to r (down). Closed edges are given infinite weight.
+ */
+class CustomizableContractionHierarchy
+{
+public:
+  static constexpr edge_weight_t kInfinite = std::numeric_limits<edge_weight_t>::max();
+
+  static constexpr vertex_id_t kNoVertex = std::numeric_limits<vertex_id_t>::max();
+
+  CustomizableContractionHierarchy() = default;
+
+  /**
+   * Orders and contracts all vertices of \c graph; call customize before searching
+   */
+  template<SearchGraph G>
+  explicit CustomizableContractionHierarchy(const G& graph)
+  {
+    const std::size_t n = graph.vertex_count();
+
+    vertex_ = nested_dissection_order(graph);
+    rank_.resize(n);
+    for (vertex_id_t r = 0; r < n; ++r)
+    {
+      rank_[vertex_[r]] = r;
+    }
+
+    // Contract in order: the upper neighbours of each vertex become a clique, which is recorded by merging
+    // them into the upper neighbours of the lowest of them (its parent in the elimination tree)
+    std::vector<std::vector<vertex_id_t>> up(n);
+    for (vertex_id_t u = 0; u < n; ++u)
+    {
+      graph.for_each_edge(
+        u,
+        [this, &up, u](vertex_id_t v, const EdgeProperties&)
+        {
+          if (u != v)
+          {
+            up[std::min(rank_[u], rank_[v])].push_back(std::max(rank_[u], rank_[v]));
+          }
+        });
+    }
+
+    up_offsets_.assign(n + 1, 0);
+    parent_.assign(n, kNoVertex);
+    for (vertex_id_t r = 0; r < n; ++r)
+    {
+      std::sort(up[r].begin(), up[r].end());
+      up[r].erase(std::unique(up[r].begin(), up[r].end()), up[r].end());
+      if (!up[r].empty())
+      {
+        parent_[r] = up[r].front();
+        up[parent_[r]].insert(up[parent_[r]].end(), up[r].begin() + 1, up[r].end());
+      }
+      up_offsets_[r + 1] = up_offsets_[r] + up[r].size();
+    }
+
+    up_targets_.reserve(up_offsets_.back());
+    for (const auto& targets : up)
+    {
+      up_targets_.insert(up_targets_.end(), targets.begin(), targets.end());
+    }
+
+    // Lower neighbours of each rank, with the ID of the arc leading up from them
+    down_offsets_.assign(n + 1, 0);
+    for (const auto s : up_targets_)
+    {
+      ++down_offsets_[s + 1];
+    }
+    std::partial_sum(down_offsets_.begin(), down_offsets_.end(), down_offsets_.begin());
+    down_arcs_.resize(up_targets_.size());
+    {
+      std::vector<std::size_t> cursor{down_offsets_.begin(), down_offsets_.end() - 1};
+      for (vertex_id_t r = 0; r < n; ++r)
+      {
+        for (std::size_t a = up_offsets_[r]; a < up_offsets_[r + 1]; ++a)
+        {
+          down_arcs_[cursor[up_targets_[a]]++] = DownArc{.source = r, .arc = static_cast<std::uint32_t>(a)};
+        }
+      }
+    }
+
+    // A rank can be customized once all of its lower neighbours are
+    std::vector<std::size_t> level(n, 0);
+    for (vertex_id_t r = 0; r < n; ++r)
+    {
+      for (const auto& down : lower(r))
+      {
+        level[r] = std::max(level[r], level[down.source] + 1);
+      }
+    }
+    const std::size_t level_count = n > 0 ? (*std::max_element(level.begin(), level.end()) + 1) : 0;
+    level_offsets_.assign(level_count + 1, 0);
+    for (const auto l : level)
+    {
+      ++level_offsets_[l + 1];
+    }
+    std::partial_sum(level_offsets_.begin(), level_offsets_.end(), level_offsets_.begin());
+    level_ranks_.resize(n);
+    {
+      std::vector<std::size_t> cursor{level_offsets_.begin(), level_offsets_.end() - 1};
+      for (vertex_id_t r = 0; r < n; ++r)
+      {
+        level_ranks_[cursor[level[r]]++] = r;
+      }
+    }
+
+    input_up_.assign(up_targets_.size(), kInfinite);
+    input_down_.assign(up_targets_.size(), kInfinite);
+    up_weight_.assign(up_targets_.size(), kInfinite);
+    down_weight_.assign(up_targets_.size(), kInfinite);
+  }
+
+  /**
+   * Computes the weights of all arcs from the current edge weights of \c graph
+   *
+   * \c graph must have the same vertices and edges as the graph this hierarchy was built from; only edge
+   * weights and validity may differ.
+   */
+  template<SearchGraph G>
+  void customize(const G& graph, std::size_t thread_count)
+  {
+    thread_count = std::max<std::size_t>(1, thread_count);
+
+    const std::size_t n = rank_.size();
+    const std::size_t arc_count = up_targets_.size();
+
+    std::barrier sync{static_cast<std::ptrdiff_t>(thread_count)};
+    const auto work = [&](std::size_t thread_index)
+    {
+      const auto range = [thread_index, thread_count](std::size_t size)
+      {
+        return std::make_pair(size * thread_index / thread_count, size * (thread_index + 1) / thread_count);
+      };
+
+      // Reset input weights
+      {
+        const auto [first, last] = range(arc_count);
+        std::fill(input_up_.begin() + first, input_up_.begin() + last, kInfinite);
+        std::fill(input_down_.begin() + first, input_down_.begin() + last, kInfinite);
+      }
+      sync.arrive_and_wait();
+
+      // Scatter edge weights onto arcs; each arc direction has a single source vertex, so ranges of source
+      // vertices never write the same weight
+      {
+        const auto [first, last] = range(n);
+        for (vertex_id_t u = first; u < last; ++u)
+        {
+          graph.for_each_edge(
+            u,
+            [this, u](vertex_id_t v, const EdgeProperties& edge)
+            {
+              if (!edge.valid or u == v)
+              {
+                return;
+              }
+              else if (rank_[u] < rank_[v])
+              {
+                auto& w = input_up_[arc(rank_[u], rank_[v])];
+                w = std::min(w, edge.weight);
+              }
+              else
+              {
+                auto& w = input_down_[arc(rank_[v], rank_[u])];
+                w = std::min(w, edge.weight);
+              }
+            });
+        }
+      }
+      sync.arrive_and_wait();
+
+      // Customize by level; ranks within a level only read arcs of lower levels
+      std::vector<std::uint32_t> arc_to(n, std::numeric_limits<std::uint32_t>::max());
+      for (std::size_t l = 0; l + 1 < level_offsets_.size(); ++l)
+      {
+        for (std::size_t i = level_offsets_[l] + thread_index; i < level_offsets_[l + 1]; i += thread_count)
+        {
+          customize_rank(level_ranks_[i], arc_to);
+        }
+        sync.arrive_and_wait();
+      }
+    };
+
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count - 1);
+    for (std::size_t thread_index = 1; thread_index < thread_count; ++thread_index)
+    {
+      threads.emplace_back(work, thread_index);
+    }
+    work(0);
+  }
+
+  std::size_t vertex_count() const { return rank_.size(); }
+
+  std::size_t arc_count() const { return up_targets_.size(); }
+
+  vertex_id_t rank(vertex_id_t q) const { return rank_[q]; }
+
+  vertex_id_t vertex(vertex_id_t r) const { return vertex_[r]; }
+
+  /**
+   * Returns the next rank above \c r on the path to the root of the elimination tree, or kNoVertex
+   *
+   * All upper neighbours of \c r lie on this path.
+   */
+  vertex_id_t parent(vertex_id_t r) const { return parent_[r]; }
+
+  /**
+   * Calls visitor(s, up_weight, down_weight) for every arc (r, s) with s above r
+   */
+  template<typename VisitorT>
+  void for_each_upward(vertex_id_t r, VisitorT&& visitor) const
+  {
+    for (std::size_t a = up_offsets_[r]; a < up_offsets_[r + 1]; ++a)
+    {
+      visitor(up_targets_[a], up_weight_[a], down_weight_[a]);
+    }
+  }
+
+  /**
+   * Relabels vertices, such that vertex q becomes vertex indices[q], as Graph::shuffle does
+   */
+  void shuffle(const std::vector<std::size_t>& indices)
+  {
+    std::vector<vertex_id_t> rank(rank_.size());
+    for (std::size_t q = 0; q < rank_.size(); ++q)
+    {
+      rank[indices[q]] = rank_[q];
+      vertex_[rank_[q]] = indices[q];
+    }
+    rank_ = std::move(rank);
+  }
+
+  /**
+   * Writes the original vertices of the customized arc from rank \c from to rank \c to, from \c to back to,
+   * but excluding, \c from
+   *
+   * Throws std::logic_error if no lower triangle accounts for the weight of a shortcut, which happens only when
+   * input weights changed without customizing again.
+   */
+  template<typename OutputIteratorT>
+  OutputIteratorT unpack_reverse(OutputIteratorT out, vertex_id_t from, vertex_id_t to) const
+  {
+    const edge_weight_t w = weight(from, to);
+    if (w == input_weight(from, to))
+    {
+      (*out) = vertex_[to];
+      return out;
+    }
+
+    // Find the lower triangle which gave this arc its weight
+    const vertex_id_t lo = std::min(from, to);
+    const vertex_id_t hi = std::max(from, to);
+    for (const auto& down : lower(lo))
+    {
+      if (find_arc(down.source, hi) != kNoArc and add(weight(from, down.source), weight(down.source, to)) == w)
+      {
+        out = unpack_reverse(out, down.source, to);
+        return unpack_reverse(out, from, down.source);
+      }
+    }
+    throw std::logic_error{"customized shortcut weight matches no lower triangle; customize after changing weights"};
+  }
+
+  static constexpr edge_weight_t add(edge_weight_t lhs, edge_weight_t rhs)
+  {
+    return (lhs == kInfinite or rhs == kInfinite) ? kInfinite : (lhs + rhs);
+  }
+
+private:
+  static constexpr std::size_t kNoArc = std::numeric_limits<std::size_t>::max();
+
+  struct DownArc
+  {
+    vertex_id_t source;
+    std::uint32_t arc;
+  };
+
+  std::span<const DownArc> lower(vertex_id_t r) const
+  {
+    return {down_arcs_.data() + down_offsets_[r], down_arcs_.data() + down_offsets_[r + 1]};
+  }
+
+  std::size_t find_arc(vertex_id_t r, vertex_id_t s) const
+  {
+    const auto first = up_targets_.begin() + up_offsets_[r];
+    const auto last = up_targets_.begin() + up_offsets_[r + 1];
+    const auto itr = std::lower_bound(first, last, s);
+    return (itr != last and *itr == s) ? static_cast<std::size_t>(itr - up_targets_.begin()) : kNoArc;
+  }
+
+  std::size_t arc(vertex_id_t r, vertex_id_t s) const { return find_arc(r, s); }
+
+  edge_weight_t weight(vertex_id_t from, vertex_id_t to) const
+  {
+    return (from < to) ? up_weight_[arc(from, to)] : down_weight_[arc(to, from)];
+  }
+
+  edge_weight_t input_weight(vertex_id_t from, vertex_id_t to) const
+  {
+    return (from < to) ? input_up_[arc(from, to)] : input_down_[arc(to, from)];
+  }
+
+  /**
+   * Sets the weights of all arcs (r, s) from their input weights and lower triangles (t, r, s)
+   */
+  void customize_rank(vertex_id_t r, std::vector<std::uint32_t>& arc_to)
+  {
+    for (std::size_t a = up_offsets_[r]; a < up_offsets_[r + 1]; ++a)
+    {
+      arc_to[up_targets_[a]] = a;
+      up_weight_[a] = input_up_[a];
+      down_weight_[a] = input_down_[a];
+    }
+
+    for (const auto& [t, tr] : lower(r))
+    {
+      // Upper neighbours of t above r are all upper neighbours of r, since the graph is chordal
+      const auto first = up_targets_.begin() + up_offsets_[t];
+      const auto last = up_targets_.begin() + up_offsets_[t + 1];
+      for (auto itr = std::upper_bound(first, last, r); itr != last; ++itr)
+      {
+        const std::size_t ts = itr - up_targets_.begin();
+        const std::size_t rs = arc_to[*itr];
+        up_weight_[rs] = std::min(up_weight_[rs], add(down_weight_[tr], up_weight_[ts]));
+        down_weight_[rs] = std::min(down_weight_[rs], add(down_weight_[ts], up_weight_[tr]));
+      }
+    }
+  }
+
+  std::vector<vertex_id_t> rank_;
+  std::vector<vertex_id_t> vertex_;
+  std::vector<vertex_id_t> parent_;
+
+  std::vector<std::size_t> up_offsets_;
+  std::vector<vertex_id_t> up_targets_;
+  std::vector<std::size_t> down_offsets_;
+  std::vector<DownArc> down_arcs_;
+
+  std::vector<std::size_t> level_offsets_;
+  std::vector<vertex_id_t> level_ranks_;
+
+  std::vector<edge_weight_t> input_up_;
+  std::vector<edge_weight_t> input_down_;
+  std::vector<edge_weight_t> up_weight_;
+  std::vector<edge_weight_t> down_weight_;
+};
+
+
+template <typename T>
+concept CustomizableHierarchicalSearchGraph =
+  SearchGraph<T> and
+  requires(T&& g)
+  {
+      { g.hierarchy() } -> std::convertible_to<const CustomizableContractionHierarchy&>;
+  };
+
+
+/**
+ * Search context for customizable contraction hierarchy queries
+ *
+ * Labels and predecessors are kept by rank; vertex IDs are only used at the interface.
+ */
+class CustomizableHierarchyQuery
+{
+public:
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  vertex_id_t goal() const { return goal_; }
+
+  /**
+   * Returns the number of ranks scanned by both directions of the last search
+   */
+  std::size_t settled_count() const { return settled_count_; }
+
+  /**
+   * Returns the length of the path found by the last search
+   */
+  edge_weight_t path_length() const { return meeting_length_; }
+
+private:
+  template<CustomizableHierarchicalSearchGraph G>
+  friend bool search(CustomizableHierarchyQuery& ctx, const G& graph, vertex_id_t start);
+
+  template<typename OutputIteratorT>
+  friend OutputIteratorT get_reverse_path(OutputIteratorT out, const CustomizableHierarchyQuery& ctx, vertex_id_t goal);
+
+  struct Label
+  {
+    edge_weight_t distance = CustomizableContractionHierarchy::kInfinite;
+    vertex_id_t predecessor = CustomizableContractionHierarchy::kNoVertex;
+  };
+
+  const CustomizableContractionHierarchy* hierarchy_ = nullptr;
+  vertex_id_t goal_;
+  std::array<EpochArray<Label>, 2> labels_;
+  vertex_id_t meeting_vertex_;
+  edge_weight_t meeting_length_ = CustomizableContractionHierarchy::kInfinite;
+  std::size_t settled_count_ = 0;
+};
+
+
+/**
+ * Scans the elimination tree paths from \c start and from the goal up to the root
+ *
+ * Every upper neighbour of a rank lies on its elimination tree path, so these paths contain the upward
+ * search spaces of both ends; scanning them in order of rank needs no priority queue.
+ */
+template<CustomizableHierarchicalSearchGraph G>
+bool search(CustomizableHierarchyQuery& ctx, const G& graph, vertex_id_t start)
+{
+  using CCH = CustomizableContractionHierarchy;
+
+  const CCH& hierarchy = graph.hierarchy();
+  ctx.hierarchy_ = &hierarchy;
+  ctx.meeting_length_ = CCH::kInfinite;
+  ctx.settled_count_ = 0;
+
+  auto& forward = ctx.labels_[0];
+  auto& backward = ctx.labels_[1];
+  forward.reset(hierarchy.vertex_count(), CustomizableHierarchyQuery::Label{});
+  backward.reset(hierarchy.vertex_count(), CustomizableHierarchyQuery::Label{});
+
+  const vertex_id_t s = hierarchy.rank(start);
+  forward.set(s, CustomizableHierarchyQuery::Label{.distance = 0, .predecessor = s});
+  for (vertex_id_t r = s; r != CCH::kNoVertex; r = hierarchy.parent(r))
+  {
+    if (const edge_weight_t distance = forward.get(r).distance; distance != CCH::kInfinite)
+    {
+      ++ctx.settled_count_;
+      hierarchy.for_each_upward(
+        r,
+        [&forward, distance, r](vertex_id_t next, edge_weight_t up, [[maybe_unused]] edge_weight_t down)
+        {
+          if (const edge_weight_t d = CCH::add(distance, up); d < forward.get(next).distance)
+          {
+            forward.set(next, CustomizableHierarchyQuery::Label{.distance = d, .predecessor = r});
+          }
+        });
+    }
+  }
+
+  const vertex_id_t t = hierarchy.rank(ctx.goal_);
+  backward.set(t, CustomizableHierarchyQuery::Label{.distance = 0, .predecessor = t});
+  for (vertex_id_t r = t; r != CCH::kNoVertex; r = hierarchy.parent(r))
+  {
+    if (const edge_weight_t distance = backward.get(r).distance; distance != CCH::kInfinite)
+    {
+      ++ctx.settled_count_;
+      if (const edge_weight_t length = CCH::add(forward.get(r).distance, distance); length < ctx.meeting_length_)
+      {
+        ctx.meeting_vertex_ = r;
+        ctx.meeting_length_ = length;
+      }
+
+      hierarchy.for_each_upward(
+        r,
+        [&backward, distance, r](vertex_id_t next, [[maybe_unused]] edge_weight_t up, edge_weight_t down)
+        {
+          if (const edge_weight_t d = CCH::add(distance, down); d < backward.get(next).distance)
+          {
+            backward.set(next, CustomizableHierarchyQuery::Label{.distance = d, .predecessor = r});
+          }
+        });
+    }
+  }
+
+  return ctx.meeting_length_ != CCH::kInfinite;
+}
+
+
+/**
+ * Writes the path found by a customizable hierarchy search from the goal back to the start, with all
+ * shortcuts unpacked
+ */
+template<typename OutputIteratorT>
+OutputIteratorT get_reverse_path(OutputIteratorT out, const CustomizableHierarchyQuery& ctx, [[maybe_unused]] vertex_id_t goal)
+{
+  const auto& forward = ctx.labels_[0];
+  const auto& backward = ctx.labels_[1];
+
+  // Backward labels lead from the meeting rank toward the goal, so collect them to emit in reverse
+  std::vector<vertex_id_t> meeting_to_goal{ctx.meeting_vertex_};
+  for (vertex_id_t r = ctx.meeting_vertex_; backward.get(r).predecessor != r; r = backward.get(r).predecessor)
+  {
+    meeting_to_goal.push_back(backward.get(r).predecessor);
+  }
+  for (std::size_t i = meeting_to_goal.size() - 1; i > 0; --i)
+  {
+    out = ctx.hierarchy_->unpack_reverse(out, meeting_to_goal[i - 1], meeting_to_goal[i]);
+  }
+
+  vertex_id_t r = ctx.meeting_vertex_;
+  for (; forward.get(r).predecessor != r; r = forward.get(r).predecessor)
+  {
+    out = ctx.hierarchy_->unpack_reverse(out, forward.get(r).predecessor, r);
+  }
+  (*out) = ctx.hierarchy_->vertex(r);
+  return out;
+}
+
+}  // namespace cppcon
@@ -0,0 +1,374 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Single-source shortest paths which settles whole distance ranges at once, in parallel (delta-stepping
+ * [Meyer and Sanders, 2003])
+ *
+ * Vertices are kept in buckets of width delta by tentative distance. The lowest non-empty bucket is emptied
+ * in phases: all threads relax the light edges (weight <= delta) of every vertex in the bucket, which may
+ * re-fill it, until it stays empty; then the heavy edges of every vertex removed from it are relaxed once,
+ * since they can only reach later buckets. Each bucket is therefore final once emptied.
+ *
+ * Distance and predecessor of each vertex are packed into one 64-bit word, distance above predecessor, and
+ * lowered with an atomic minimum, so both always belong to the same path; ties go to the lowest predecessor,
+ * which makes the result independent of the thread count. Each thread fills buckets of its own, which are
+ * merged between phases. Buckets are indexed by distance / delta and grow on demand, so edge weights need
+ * no bound and may change between searches.
+ *
+ * With a goal set, the search stops once the bucket holding the goal is emptied; otherwise every vertex
+ * reachable from the start is settled. The source is its own predecessor, as get_reverse_path() expects.
+ */
+class DeltaStepping
+{
+public:
+  static constexpr edge_weight_t kUnreached = std::numeric_limits<edge_weight_t>::max();
+
+  static constexpr vertex_id_t kNoGoal = std::numeric_limits<vertex_id_t>::max();
+
+  /**
+   * \param thread_count  threads which relax edges; the calling thread is one of them
+   * \param delta  bucket width, or 0 to use a few times the average edge weight of each graph searched
+   */
+  explicit DeltaStepping(std::size_t thread_count = 1, edge_weight_t delta = 0) :
+    thread_count_{std::max<std::size_t>(1, thread_count)},
+    requested_delta_{delta}
+  {}
+
+  DeltaStepping(const DeltaStepping&) = delete;
+
+  DeltaStepping& operator=(const DeltaStepping&) = delete;
+
+  /**
+   * Sets the vertex at which the next search may stop, or kNoGoal to settle every reachable vertex
+   */
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  vertex_id_t goal() const { return goal_; }
+
+  /**
+   * Returns the bucket width used by the last search
+   */
+  edge_weight_t delta() const { return delta_; }
+
+  /**
+   * Returns the number of light-edge phases run by the last search, each of which ends at a barrier
+   */
+  std::size_t phase_count() const { return phase_count_; }
+
+  bool is_reached(vertex_id_t q) const { return distance(q) != kUnreached; }
+
+  /**
+   * Returns the distance of \c q from the start, which is final if \c q was settled
+   */
+  edge_weight_t distance(vertex_id_t q) const { return labels_[q].load(std::memory_order_relaxed) >> 32; }
+
+  vertex_id_t predecessor(vertex_id_t q) const { return static_cast<vertex_id_t>(labels_[q].load(std::memory_order_relaxed)); }
+
+private:
+  template<SearchGraph G>
+  friend bool search(DeltaStepping& ctx, const G& graph, vertex_id_t start);
+
+  enum class Step
+  {
+    kLight,
+    kHeavy,
+    kDone,
+  };
+
+  static constexpr std::uint64_t label(edge_weight_t distance, vertex_id_t pred)
+  {
+    return (std::uint64_t{distance} << 32) | pred;
+  }
+
+  /**
+   * Buckets filled by one thread, indexed by bucket
+   */
+  struct alignas(64) ThreadBuckets
+  {
+    std::vector<std::vector<vertex_id_t>> buckets;
+
+    void push(std::size_t bucket, vertex_id_t v)
+    {
+      if (bucket >= buckets.size())
+      {
+        buckets.resize(bucket + 1);
+      }
+      buckets[bucket].push_back(v);
+    }
+
+    bool is_empty(std::size_t bucket) const { return bucket >= buckets.size() or buckets[bucket].empty(); }
+  };
+
+  /**
+   * Lowers the label of \c v to (distance, pred) and files \c v under its new bucket if its distance dropped
+   */
+  void relax(ThreadBuckets& buckets, vertex_id_t v, edge_weight_t distance, vertex_id_t pred)
+  {
+    const std::uint64_t relaxed_label = label(distance, pred);
+    std::uint64_t current = labels_[v].load(std::memory_order_relaxed);
+    while (relaxed_label < current)
+    {
+      if (labels_[v].compare_exchange_weak(current, relaxed_label, std::memory_order_relaxed))
+      {
+        if (distance < (current >> 32))
+        {
+          buckets.push(distance / delta_, v);
+        }
+        return;
+      }
+    }
+  }
+
+  /**
+   * Relaxes the light or heavy edges of every vertex of frontier_[first, last) which is still in bucket_
+   */
+  template<SearchGraph G>
+  void relax_frontier(const G& graph, ThreadBuckets& buckets, std::size_t first, std::size_t last, bool light)
+  {
+    for (std::size_t i = first; i < last; ++i)
+    {
+      const vertex_id_t q = frontier_[i];
+      const edge_weight_t d = distance(q);
+      if (d / delta_ != bucket_)
+      {
+        // Moved to an earlier bucket since it was queued here
+        continue;
+      }
+      graph.for_each_edge(
+        q,
+        [&](vertex_id_t child, const EdgeProperties& edge)
+        {
+          if (edge.valid and ((edge.weight <= delta_) == light))
+          {
+            relax(buckets, child, d + edge.weight, q);
+          }
+        });
+    }
+  }
+
+  /**
+   * Chooses the work of the next phase; runs on one thread while all others wait
+   */
+  void advance()
+  {
+    if (step_ == Step::kHeavy)
+    {
+      settled_.clear();
+
+      // Every vertex of the bucket just emptied is final
+      if (goal_ != kNoGoal and distance(goal_) / delta_ <= bucket_)
+      {
+        step_ = Step::kDone;
+        return;
+      }
+
+      std::size_t bucket_count = 0;
+      for (std::size_t t = 0; t < thread_count_; ++t)
+      {
+        bucket_count = std::max(bucket_count, buckets_[t].buckets.size());
+      }
+      std::size_t next = bucket_ + 1;
+      for (; next < bucket_count; ++next)
+      {
+        if (std::any_of(buckets_.get(), buckets_.get() + thread_count_, [&](const ThreadBuckets& b) { return !b.is_empty(next); }))
+        {
+          break;
+        }
+      }
+      if (next >= bucket_count)
+      {
+        step_ = Step::kDone;
+        return;
+      }
+      bucket_ = next;
+    }
+
+    // Gather the current bucket from every thread; while it keeps re-filling, relax its light edges
+    frontier_.clear();
+    for (std::size_t t = 0; t < thread_count_; ++t)
+    {
+      if (buckets_[t].is_empty(bucket_))
+      {
+        continue;
+      }
+      auto& bucket = buckets_[t].buckets[bucket_];
+      frontier_.insert(frontier_.end(), bucket.begin(), bucket.end());
+      bucket.clear();
+    }
+
+    if (frontier_.empty())
+    {
+      frontier_.swap(settled_);
+      step_ = Step::kHeavy;
+    }
+    else
+    {
+      settled_.insert(settled_.end(), frontier_.begin(), frontier_.end());
+      step_ = Step::kLight;
+      ++phase_count_;
+    }
+  }
+
+  /**
+   * Sizes labels and empties buckets for \c graph, choosing delta on the first search of each graph
+   *
+   * Delta only sets how much work each phase does; weights updated in place since it was chosen make the search
+   * less efficient, never wrong, since buckets are not bounded by any edge weight.
+   */
+  template<SearchGraph G>
+  void prepare(const G& graph)
+  {
+    const std::size_t n = graph.vertex_count();
+    if (label_count_ != n)
+    {
+      labels_ = std::make_unique<std::atomic<std::uint64_t>[]>(n);
+      label_count_ = n;
+    }
+
+    if (graph_ != &graph)
+    {
+      std::uint64_t total_weight = 0;
+      std::size_t edge_count = 0;
+      for (vertex_id_t q = 0; q < n; ++q)
+      {
+        graph.for_each_edge(
+          q,
+          [&](vertex_id_t, const EdgeProperties& edge)
+          {
+            if (edge.valid)
+            {
+              total_weight += edge.weight;
+              ++edge_count;
+            }
+          });
+      }
+      average_weight_ = static_cast<edge_weight_t>(std::max<std::uint64_t>(1, total_weight / std::max<std::size_t>(1, edge_count)));
+      graph_ = &graph;
+    }
+
+    delta_ = (requested_delta_ != 0) ? requested_delta_ : (kAutoDeltaEdges * average_weight_);
+
+    if (!buckets_)
+    {
+      buckets_ = std::make_unique<ThreadBuckets[]>(thread_count_);
+    }
+    for (std::size_t t = 0; t < thread_count_; ++t)
+    {
+      for (auto& bucket : buckets_[t].buckets)
+      {
+        bucket.clear();
+      }
+    }
+  }
+
+  /// Default bucket width, in average edge weights
+  static constexpr edge_weight_t kAutoDeltaEdges = 4;
+
+  std::size_t thread_count_;
+  edge_weight_t requested_delta_;
+  edge_weight_t delta_ = 1;
+
+  vertex_id_t goal_ = kNoGoal;
+
+  const void* graph_ = nullptr;
+  edge_weight_t average_weight_ = 1;
+
+  std::size_t label_count_ = 0;
+  std::unique_ptr<std::atomic<std::uint64_t>[]> labels_;
+
+  std::unique_ptr<ThreadBuckets[]> buckets_;
+
+  Step step_ = Step::kLight;
+  std::size_t bucket_ = 0;
+  std::vector<vertex_id_t> frontier_;
+  std::vector<vertex_id_t> settled_;
+
+  std::size_t phase_count_ = 0;
+};
+
+
+/**
+ * Computes shortest paths from \c start, up to the goal of \c ctx if one is set
+ *
+ * \return true if the goal was reached, or if no goal is set
+ */
+template<SearchGraph G>
+bool search(DeltaStepping& ctx, const G& graph, vertex_id_t start)
+{
+  ctx.prepare(graph);
+
+  const std::size_t n = graph.vertex_count();
+  const std::size_t thread_count = ctx.thread_count_;
+
+  ctx.phase_count_ = 0;
+  ctx.bucket_ = 0;
+  ctx.settled_.clear();
+  ctx.buckets_[0].push(0, start);
+
+  // Runs once all threads arrive, before any is released: the start is gathered as the first frontier
+  ctx.step_ = DeltaStepping::Step::kLight;
+  std::barrier sync{static_cast<std::ptrdiff_t>(thread_count), [&ctx]() noexcept { ctx.advance(); }};
+
+  const auto work = [&](std::size_t t)
+  {
+    // Labels are reset by all threads, each over its own range
+    for (std::size_t q = n * t / thread_count; q < n * (t + 1) / thread_count; ++q)
+    {
+      ctx.labels_[q].store((q == start) ? DeltaStepping::label(0, start) : std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+    }
+    sync.arrive_and_wait();
+
+    while (ctx.step_ != DeltaStepping::Step::kDone)
+    {
+      const std::size_t size = ctx.frontier_.size();
+      ctx.relax_frontier(graph, ctx.buckets_[t], size * t / thread_count, size * (t + 1) / thread_count, ctx.step_ == DeltaStepping::Step::kLight);
+      sync.arrive_and_wait();
+    }
+  };
+
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count - 1);
+    for (std::size_t t = 1; t < thread_count; ++t)
+    {
+      threads.emplace_back(work, t);
+    }
+    work(0);
+  }
+
+  return (ctx.goal_ == DeltaStepping::kNoGoal) or ctx.is_reached(ctx.goal_);
+}
+
+
+/**
+ * Writes the path found by the last delta-stepping search from \c goal back to the start
+ */
+template<typename OutputIteratorT>
+OutputIteratorT get_reverse_path(OutputIteratorT out, const DeltaStepping& ctx, vertex_id_t goal)
+{
+  (*out) = goal;
+  for (vertex_id_t q = goal; ctx.predecessor(q) != q; q = ctx.predecessor(q))
+  {
+    (*out) = ctx.predecessor(q);
+  }
+  return out;
+}
+
+}  // namespace cppcon
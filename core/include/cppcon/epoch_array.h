@@ -0,0 +1,84 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cppcon
+{
+
+/**
+ * Per-vertex values which are reset in O(1) by advancing an epoch
+ *
+ * Each slot holds the epoch in which it was last written next to its value; slots from earlier epochs read
+ * as the default value. Resetting only bumps the current epoch, so a search which touches k vertices costs
+ * O(k) to set up and tear down instead of O(V). Slots are re-stamped in full once every 2^32 resets, when
+ * the epoch counter wraps.
+ */
+template<typename T>
+class EpochArray
+{
+public:
+  /**
+   * Sizes the array and makes every slot read as \c default_value
+   */
+  void reset(std::size_t size, const T& default_value)
+  {
+    default_value_ = default_value;
+    if (size != slots_.size())
+    {
+      slots_.assign(size, Slot{.epoch = 0, .value = default_value});
+      epoch_ = 1;
+    }
+    else if (++epoch_ == 0)
+    {
+      std::for_each(slots_.begin(), slots_.end(), [](Slot& slot) { slot.epoch = 0; });
+      epoch_ = 1;
+    }
+  }
+
+  std::size_t size() const { return slots_.size(); }
+
+  /**
+   * Returns true if slot \c q has been written since the last reset
+   */
+  bool is_set(std::size_t q) const { return slots_[q].epoch == epoch_; }
+
+  const T& get(std::size_t q) const
+  {
+    const auto& slot = slots_[q];
+    return (slot.epoch == epoch_) ? slot.value : default_value_;
+  }
+
+  void set(std::size_t q, const T& value)
+  {
+    slots_[q] = Slot{.epoch = epoch_, .value = value};
+  }
+
+  /**
+   * Returns a mutable reference to slot \c q, initializing it to the default value if it is stale
+   */
+  T& touch(std::size_t q)
+  {
+    auto& slot = slots_[q];
+    if (slot.epoch != epoch_)
+    {
+      slot = Slot{.epoch = epoch_, .value = default_value_};
+    }
+    return slot.value;
+  }
+
+private:
+  struct Slot
+  {
+    std::uint32_t epoch;
+    T value;
+  };
+
+  std::vector<Slot> slots_;
+  std::uint32_t epoch_ = 0;
+  T default_value_{};
+};
+
+}  // namespace cppcon
@@ -0,0 +1,105 @@
+#pragma once
+
+// C++ Standard Library
+#include <functional>
+#include <limits>
+#include <queue>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Shortest-path tree rooted at a goal vertex
+ *
+ * A SearchContext which never terminates: searching from the goal over a transposed graph settles every
+ * vertex which can reach the goal, and leaves each one's predecessor set to its next hop toward the goal.
+ * Paths from any number of starts to that goal are then read back without searching again.
+ */
+class GoalTree
+{
+public:
+  template<SearchGraph G>
+  void reset(G&& graph, vertex_id_t goal)
+  {
+    goal_ = goal;
+    queue_ = {};
+    next_hop_.assign(graph.vertex_count(), kUnreached);
+    enqueue(goal, goal, 0);
+  }
+
+  vertex_id_t goal() const { return goal_; }
+
+  /**
+   * Returns true if a path from \c s to the goal exists
+   */
+  bool is_reachable(vertex_id_t s) const { return next_hop_[s] != kUnreached; }
+
+  bool is_queue_not_empty() const { return !queue_.empty(); }
+
+  bool is_visited(vertex_id_t q) const { return next_hop_[q] != kUnreached; }
+
+  bool is_terminal([[maybe_unused]] vertex_id_t q) const { return false; }
+
+  void mark_visited(vertex_id_t p, vertex_id_t s) { next_hop_[s] = p; }
+
+  /**
+   * Returns the vertex after \c q on its shortest path to the goal, or the goal itself if \c q is the goal
+   */
+  vertex_id_t predecessor(vertex_id_t q) const { return next_hop_[q]; }
+
+  Transition dequeue()
+  {
+    auto t = queue_.top();
+    queue_.pop();
+    return t;
+  }
+
+  void enqueue(vertex_id_t p, vertex_id_t s, edge_weight_t w)
+  {
+    queue_.push(Transition{
+      .pred = p,
+      .succ = s,
+      .weight = w
+    });
+  }
+
+private:
+  static constexpr vertex_id_t kUnreached = std::numeric_limits<vertex_id_t>::max();
+
+  vertex_id_t goal_ = kUnreached;
+
+  std::priority_queue<Transition, std::vector<Transition>, std::greater<Transition>> queue_;
+
+  std::vector<vertex_id_t> next_hop_;
+};
+
+/**
+ * Builds the shortest-path tree to \c goal with a single reverse Dijkstra search
+ *
+ * \param reverse_graph  the search graph with its edges reversed, e.g. a TransposedGraph
+ */
+template<SearchGraph G>
+void plan_all_to_goal(GoalTree& tree, const G& reverse_graph, vertex_id_t goal)
+{
+  search(tree, reverse_graph, goal);
+}
+
+/**
+ * Writes the path from \c start to the goal of \c tree, in order, if \c start can reach the goal
+ */
+template<typename OutputIteratorT>
+bool get_path_to_goal(OutputIteratorT out, const GoalTree& tree, vertex_id_t start)
+{
+  if (!tree.is_reachable(start))
+  {
+    return false;
+  }
+  get_reverse_path(out, tree, start);
+  return true;
+}
+
+}  // namespace cppcon
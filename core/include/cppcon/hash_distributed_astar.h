@@ -0,0 +1,389 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <latch>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// CppCon
+#include <cppcon/mpsc_queue.h>
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * A* split across threads by vertex ownership (HDA* [Kishimoto, Fukunaga and Botea, 2009])
+ *
+ * Every vertex is owned by one thread, chosen by hashing its ID, and only its owner keeps its distance,
+ * predecessor and queue entries, so no per-vertex state is shared. A thread expanding a vertex sends each
+ * child it does not own to the child's owner as a (child, distance, parent) message, through a lock-free
+ * MpscQueue per thread; messages are batched per receiver to keep queue traffic low.
+ *
+ * Reaching the goal only sets an incumbent path length. The search ends once every thread is idle (nothing
+ * queued with an f-value below the incumbent, nothing received) and no message is in flight; threads which
+ * become busy again count themselves on an activity counter, which an idle thread reads before and after
+ * checking, so a check which overlaps any wake-up is discarded. Vertices may be expanded more than once when
+ * a shorter distance arrives later, so the path found is optimal whenever the heuristic is admissible, even
+ * if it is not consistent.
+ *
+ * \param HeuristicT  policy such that, after reset(graph, goal), heuristic(q) bounds the distance from q to
+ *                    the goal from below; it is evaluated by all threads at once
+ */
+template<typename HeuristicT>
+class HashDistributedAStar
+{
+public:
+  static constexpr edge_weight_t kUnreached = std::numeric_limits<edge_weight_t>::max();
+
+  /**
+   * \param thread_count  threads which expand vertices; the calling thread is one of them
+   */
+  explicit HashDistributedAStar(std::size_t thread_count = 1) :
+    thread_count_{std::max<std::size_t>(1, thread_count)},
+    workers_{std::make_unique<Worker[]>(thread_count_)}
+  {}
+
+  HashDistributedAStar(const HashDistributedAStar&) = delete;
+
+  HashDistributedAStar& operator=(const HashDistributedAStar&) = delete;
+
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  vertex_id_t goal() const { return goal_; }
+
+  /**
+   * Returns the distance at which the goal was reached by the last search, or kUnreached
+   *
+   * Equal to the length of the path found if the heuristic is admissible.
+   */
+  edge_weight_t path_length() const { return incumbent_.load(std::memory_order_relaxed); }
+
+  /**
+   * Returns the number of expansions by all threads in the last search, including re-expansions
+   */
+  std::size_t expanded_count() const { return sum(&Worker::expanded); }
+
+  /**
+   * Returns the number of children sent to other threads in the last search
+   */
+  std::size_t message_count() const { return sum(&Worker::sent); }
+
+  vertex_id_t predecessor(vertex_id_t q) const { return predecessor_[q]; }
+
+private:
+  template<SearchGraph G, typename H>
+  friend bool search(HashDistributedAStar<H>& ctx, const G& graph, vertex_id_t start);
+
+  struct Message
+  {
+    vertex_id_t vertex;
+    vertex_id_t pred;
+    edge_weight_t distance;
+  };
+
+  struct Entry
+  {
+    std::uint64_t f;
+    edge_weight_t distance;
+    vertex_id_t vertex;
+
+    constexpr bool operator>(const Entry& other) const { return f > other.f; }
+  };
+
+  /// Children buffered for one receiver before they are pushed as one batch
+  static constexpr std::size_t kBatchSize = 64;
+
+  /// Expansions after which all buffered children are sent, so other threads are not kept waiting
+  static constexpr std::size_t kFlushInterval = 16;
+
+  struct alignas(64) Worker
+  {
+    MpscQueue<std::vector<Message>> inbox;
+    std::vector<Entry> queue;
+    std::vector<std::vector<Message>> outbox;
+    std::atomic<bool> idle{false};
+    std::size_t expanded = 0;
+    std::size_t sent = 0;
+  };
+
+  std::size_t sum(std::size_t Worker::* counter) const
+  {
+    std::size_t total = 0;
+    for (std::size_t t = 0; t < thread_count_; ++t)
+    {
+      total += workers_[t].*counter;
+    }
+    return total;
+  }
+
+  std::size_t owner(vertex_id_t q) const
+  {
+    // Multiplicative hash, mapped onto [0, thread_count_) by multiply-shift
+    return (std::uint64_t{static_cast<std::uint32_t>(q * 0x9E3779B1U)} * thread_count_) >> 32;
+  }
+
+  bool can_improve(std::uint64_t f) const { return f < incumbent_.load(std::memory_order_relaxed); }
+
+  void lower_incumbent(edge_weight_t length)
+  {
+    edge_weight_t current = incumbent_.load(std::memory_order_relaxed);
+    while (length < current and !incumbent_.compare_exchange_weak(current, length, std::memory_order_relaxed));
+  }
+
+  /**
+   * Queues \c q, owned by \c worker, if \c distance is shorter than any distance it was reached at before
+   */
+  void receive(Worker& worker, const Message& message)
+  {
+    const auto [q, pred, distance] = message;
+    if (distance >= distance_[q])
+    {
+      return;
+    }
+    distance_[q] = distance;
+    predecessor_[q] = pred;
+    if (const std::uint64_t f = std::uint64_t{distance} + heuristic_(q); can_improve(f))
+    {
+      worker.queue.push_back(Entry{.f = f, .distance = distance, .vertex = q});
+      std::push_heap(worker.queue.begin(), worker.queue.end(), std::greater<Entry>{});
+    }
+  }
+
+  void send(Worker& worker, std::size_t receiver)
+  {
+    auto& batch = worker.outbox[receiver];
+    if (!batch.empty())
+    {
+      worker.sent += batch.size();
+      in_flight_.fetch_add(batch.size());
+      workers_[receiver].inbox.push(std::move(batch));
+      batch = {};
+      batch.reserve(kBatchSize);
+    }
+  }
+
+  /**
+   * Returns true if the search has ended; called by idle threads
+   */
+  bool is_quiescent() const
+  {
+    const std::uint64_t activity = activity_.load();
+    for (std::size_t t = 0; t < thread_count_; ++t)
+    {
+      if (!workers_[t].idle.load())
+      {
+        return false;
+      }
+    }
+    return in_flight_.load() == 0 and activity_.load() == activity;
+  }
+
+  template<SearchGraph G>
+  void run(const G& graph, std::size_t self)
+  {
+    Worker& worker = workers_[self];
+    std::size_t since_flush = 0;
+
+    while (!done_.load(std::memory_order_acquire))
+    {
+      // A thread which receives anything while idle counts itself busy before it takes any message
+      if (!worker.inbox.empty())
+      {
+        if (worker.idle.load(std::memory_order_relaxed))
+        {
+          activity_.fetch_add(1);
+          worker.idle.store(false);
+        }
+
+        std::size_t received = 0;
+        worker.inbox.consume_all(
+          [&](std::vector<Message>&& batch)
+          {
+            for (const auto& message : batch)
+            {
+              receive(worker, message);
+            }
+            received += batch.size();
+          });
+        in_flight_.fetch_sub(received);
+      }
+
+      // Once the best entry can no longer beat the incumbent, none can
+      if (!worker.queue.empty() and !can_improve(worker.queue.front().f))
+      {
+        worker.queue.clear();
+      }
+
+      if (worker.queue.empty())
+      {
+        for (std::size_t t = 0; t < thread_count_; ++t)
+        {
+          send(worker, t);
+        }
+        since_flush = 0;
+
+        if (worker.inbox.empty())
+        {
+          worker.idle.store(true);
+          if (is_quiescent())
+          {
+            done_.store(true, std::memory_order_release);
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+        continue;
+      }
+
+      std::pop_heap(worker.queue.begin(), worker.queue.end(), std::greater<Entry>{});
+      const Entry entry = worker.queue.back();
+      worker.queue.pop_back();
+      if (entry.distance != distance_[entry.vertex])
+      {
+        // Reached at a shorter distance since it was queued
+        continue;
+      }
+
+      ++worker.expanded;
+      if (entry.vertex == goal_)
+      {
+        lower_incumbent(entry.distance);
+        continue;
+      }
+
+      graph.for_each_edge(
+        entry.vertex,
+        [&](vertex_id_t child, const EdgeProperties& edge)
+        {
+          if (!edge.valid)
+          {
+            return;
+          }
+          const Message message{.vertex = child, .pred = entry.vertex, .distance = entry.distance + edge.weight};
+          if (const std::size_t receiver = owner(child); receiver == self)
+          {
+            receive(worker, message);
+          }
+          else if (can_improve(std::uint64_t{message.distance} + heuristic_(child)))
+          {
+            worker.outbox[receiver].push_back(message);
+            if (worker.outbox[receiver].size() == kBatchSize)
+            {
+              send(worker, receiver);
+            }
+          }
+        });
+
+      if (++since_flush == kFlushInterval)
+      {
+        for (std::size_t t = 0; t < thread_count_; ++t)
+        {
+          send(worker, t);
+        }
+        since_flush = 0;
+      }
+    }
+  }
+
+  std::size_t thread_count_;
+  std::unique_ptr<Worker[]> workers_;
+
+  HeuristicT heuristic_;
+
+  vertex_id_t goal_ = 0;
+
+  /// Written only by the owner of each vertex
+  std::vector<edge_weight_t> distance_;
+  std::vector<vertex_id_t> predecessor_;
+
+  std::atomic<edge_weight_t> incumbent_ = kUnreached;
+  std::atomic<std::int64_t> in_flight_ = 0;
+  std::atomic<std::uint64_t> activity_ = 0;
+  std::atomic<bool> done_ = false;
+};
+
+
+/**
+ * Finds a shortest path from \c start to the goal of \c ctx on all of its threads
+ */
+template<SearchGraph G, typename H>
+bool search(HashDistributedAStar<H>& ctx, const G& graph, vertex_id_t start)
+{
+  using Context = HashDistributedAStar<H>;
+
+  const std::size_t n = graph.vertex_count();
+  const std::size_t thread_count = ctx.thread_count_;
+
+  ctx.heuristic_.reset(graph, ctx.goal_);
+  ctx.distance_.resize(n);
+  ctx.predecessor_.resize(n);
+  ctx.incumbent_.store(Context::kUnreached);
+  ctx.in_flight_.store(0);
+  ctx.activity_.store(0);
+  ctx.done_.store(false);
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    auto& worker = ctx.workers_[t];
+    worker.queue.clear();
+    worker.outbox.resize(thread_count);
+    worker.idle.store(false);
+    worker.expanded = 0;
+    worker.sent = 0;
+  }
+
+  // Distances are reset by all threads, each over its own range, before any thread starts searching
+  std::latch reset{static_cast<std::ptrdiff_t>(thread_count)};
+  const auto work = [&](std::size_t t)
+  {
+    std::fill(ctx.distance_.begin() + n * t / thread_count, ctx.distance_.begin() + n * (t + 1) / thread_count, Context::kUnreached);
+    if (ctx.owner(start) == t)
+    {
+      reset.arrive_and_wait();
+      ctx.receive(ctx.workers_[t], typename Context::Message{.vertex = start, .pred = start, .distance = 0});
+    }
+    else
+    {
+      reset.arrive_and_wait();
+    }
+    ctx.run(graph, t);
+  };
+
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count - 1);
+    for (std::size_t t = 1; t < thread_count; ++t)
+    {
+      threads.emplace_back(work, t);
+    }
+    work(0);
+  }
+
+  return ctx.path_length() != Context::kUnreached;
+}
+
+
+/**
+ * Writes the path found by the last HDA* search from \c goal back to the start
+ */
+template<typename OutputIteratorT, typename H>
+OutputIteratorT get_reverse_path(OutputIteratorT out, const HashDistributedAStar<H>& ctx, vertex_id_t goal)
+{
+  (*out) = goal;
+  for (vertex_id_t q = goal; ctx.predecessor(q) != q; q = ctx.predecessor(q))
+  {
+    (*out) = ctx.predecessor(q);
+  }
+  return out;
+}
+
+}  // namespace cppcon
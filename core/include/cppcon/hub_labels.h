@@ -0,0 +1,265 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// CppCon
+#include <cppcon/contraction_hierarchy.h>
+#include <cppcon/search.h>
+#include <cppcon/transpose.h>
+
+namespace cppcon
+{
+
+/**
+ * Returns the vertices of \c hierarchy from the most to the least important, i.e. by decreasing rank
+ */
+inline std::vector<vertex_id_t> order_by_importance(const ContractionHierarchy& hierarchy)
+{
+  std::vector<vertex_id_t> order(hierarchy.vertex_count());
+  for (std::size_t i = 0; i < order.size(); ++i)
+  {
+    order[i] = hierarchy.vertex(order.size() - 1 - i);
+  }
+  return order;
+}
+
+
+/**
+ * Distance oracle which answers d(s, t) from two precomputed labels, without searching
+ *
+ * Every vertex has an out-label of (hub, d(v, hub)) and an in-label of (hub, d(hub, v)) such that every
+ * shortest s-t path passes through a hub common to the out-label of s and the in-label of t. Labels are
+ * built by pruned landmark labeling: one forward and one backward Dijkstra search is run from each vertex
+ * in order of importance, and each search is pruned wherever the labels built so far already give the
+ * distance it found. Hubs are numbered by position in that order, so every label is sorted by hub.
+ *
+ * Labels are stored back to back in one arena, with hubs and distances in separate arrays, so that the
+ * query is a linear merge of two sorted runs of integers.
+ */
+class HubLabels
+{
+public:
+  static constexpr edge_weight_t kUnreachable = std::numeric_limits<edge_weight_t>::max();
+
+  HubLabels() = default;
+
+  /**
+   * \param order  all vertices of \c graph, most important first
+   */
+  template<SearchGraph G>
+  HubLabels(const G& graph, const std::vector<vertex_id_t>& order)
+  {
+    const std::size_t n = graph.vertex_count();
+
+    std::array<std::vector<std::vector<Entry>>, 2> labels;
+    labels[kOut].resize(n);
+    labels[kIn].resize(n);
+
+    const TransposedGraph<G> reverse_graph{graph};
+
+    // Distances of the root to each hub of its own label, indexed by hub, for O(|label|) prune checks
+    std::vector<edge_weight_t> root_label(n, kUnreachable);
+
+    std::vector<edge_weight_t> distance(n, kUnreachable);
+    std::vector<vertex_id_t> touched;
+    using QueueEntry = std::pair<edge_weight_t, vertex_id_t>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+    const auto pruned_search = [&](const auto& g, vertex_id_t root, hub_id_t hub, Side root_side)
+    {
+      const Side reached_side = (root_side == kOut) ? kIn : kOut;
+
+      for (const auto& entry : labels[root_side][root])
+      {
+        root_label[entry.hub] = entry.distance;
+      }
+
+      queue.emplace(0, root);
+      distance[root] = 0;
+      touched.push_back(root);
+      while (!queue.empty())
+      {
+        const auto [d, q] = queue.top();
+        queue.pop();
+        if (d > distance[q])
+        {
+          continue;
+        }
+
+        // Prune if an already labeled hub covers this distance
+        const auto& label = labels[reached_side][q];
+        if (std::any_of(
+              label.begin(),
+              label.end(),
+              [&root_label, d](const Entry& entry)
+              {
+                return root_label[entry.hub] != kUnreachable and std::uint64_t{root_label[entry.hub]} + entry.distance <= d;
+              }))
+        {
+          continue;
+        }
+        labels[reached_side][q].push_back(Entry{.hub = hub, .distance = d});
+
+        g.for_each_edge(
+          q,
+          [&](vertex_id_t child, const EdgeProperties& edge)
+          {
+            if (edge.valid and d + edge.weight < distance[child])
+            {
+              if (distance[child] == kUnreachable)
+              {
+                touched.push_back(child);
+              }
+              distance[child] = d + edge.weight;
+              queue.emplace(distance[child], child);
+            }
+          });
+      }
+
+      for (const auto q : touched)
+      {
+        distance[q] = kUnreachable;
+      }
+      touched.clear();
+      for (const auto& entry : labels[root_side][root])
+      {
+        root_label[entry.hub] = kUnreachable;
+      }
+    };
+
+    for (hub_id_t hub = 0; hub < order.size(); ++hub)
+    {
+      // Forward search adds the root to in-labels, then the backward search adds it to out-labels
+      pruned_search(graph, order[hub], hub, kOut);
+      pruned_search(reverse_graph, order[hub], hub, kIn);
+    }
+
+    for (const Side side : {kOut, kIn})
+    {
+      auto& arena = arenas_[side];
+      arena.offsets.assign(n + 1, 0);
+      for (vertex_id_t q = 0; q < n; ++q)
+      {
+        arena.offsets[q + 1] = arena.offsets[q] + labels[side][q].size();
+      }
+      arena.hubs.reserve(arena.offsets.back());
+      arena.distances.reserve(arena.offsets.back());
+      for (auto& label : labels[side])
+      {
+        for (const auto& entry : label)
+        {
+          arena.hubs.push_back(entry.hub);
+          arena.distances.push_back(entry.distance);
+        }
+        label = {};
+      }
+    }
+  }
+
+  /**
+   * Returns the length of the shortest path from \c s to \c t, or kUnreachable
+   */
+  edge_weight_t distance(vertex_id_t s, vertex_id_t t) const
+  {
+    const auto& out = arenas_[kOut];
+    const auto& in = arenas_[kIn];
+
+    std::size_t i = out.offsets[s];
+    std::size_t j = in.offsets[t];
+    const std::size_t i_end = out.offsets[s + 1];
+    const std::size_t j_end = in.offsets[t + 1];
+
+    // Merge of two sorted hub lists; advancing both cursors by comparison results keeps the loop free of
+    // unpredictable branches
+    std::uint64_t best = kUnreachable;
+    while (i < i_end and j < j_end)
+    {
+      const hub_id_t lhs = out.hubs[i];
+      const hub_id_t rhs = in.hubs[j];
+      const std::uint64_t length = std::uint64_t{out.distances[i]} + in.distances[j];
+      best = (lhs == rhs and length < best) ? length : best;
+      i += (lhs <= rhs);
+      j += (rhs <= lhs);
+    }
+    return static_cast<edge_weight_t>(best);
+  }
+
+  std::size_t vertex_count() const { return arenas_[kOut].offsets.empty() ? 0 : arenas_[kOut].offsets.size() - 1; }
+
+  /**
+   * Returns the total number of (hub, distance) entries over all in- and out-labels
+   */
+  std::size_t entry_count() const { return arenas_[kOut].hubs.size() + arenas_[kIn].hubs.size(); }
+
+  std::size_t memory_bytes() const
+  {
+    std::size_t bytes = 0;
+    for (const auto& arena : arenas_)
+    {
+      bytes += arena.offsets.size() * sizeof(std::size_t) +
+               arena.hubs.size() * sizeof(hub_id_t) +
+               arena.distances.size() * sizeof(edge_weight_t);
+    }
+    return bytes;
+  }
+
+  /**
+   * Relabels vertices, such that vertex q becomes vertex indices[q], as Graph::shuffle does
+   *
+   * Hubs are numbered by importance rather than by vertex, so only the order of labels changes.
+   */
+  void shuffle(const std::vector<std::size_t>& indices)
+  {
+    for (auto& arena : arenas_)
+    {
+      Arena shuffled;
+      shuffled.offsets.assign(arena.offsets.size(), 0);
+      for (std::size_t q = 0; q < indices.size(); ++q)
+      {
+        shuffled.offsets[indices[q] + 1] = arena.offsets[q + 1] - arena.offsets[q];
+      }
+      std::partial_sum(shuffled.offsets.begin(), shuffled.offsets.end(), shuffled.offsets.begin());
+      shuffled.hubs.resize(arena.hubs.size());
+      shuffled.distances.resize(arena.distances.size());
+      for (std::size_t q = 0; q < indices.size(); ++q)
+      {
+        const auto first = arena.offsets[q];
+        const auto last = arena.offsets[q + 1];
+        std::copy(arena.hubs.begin() + first, arena.hubs.begin() + last, shuffled.hubs.begin() + shuffled.offsets[indices[q]]);
+        std::copy(arena.distances.begin() + first, arena.distances.begin() + last, shuffled.distances.begin() + shuffled.offsets[indices[q]]);
+      }
+      arena = std::move(shuffled);
+    }
+  }
+
+private:
+  using hub_id_t = std::uint32_t;
+
+  enum Side : std::size_t { kOut = 0, kIn = 1 };
+
+  struct Entry
+  {
+    hub_id_t hub;
+    edge_weight_t distance;
+  };
+
+  struct Arena
+  {
+    std::vector<std::size_t> offsets;
+    std::vector<hub_id_t> hubs;
+    std::vector<edge_weight_t> distances;
+  };
+
+  std::array<Arena, 2> arenas_;
+};
+
+}  // namespace cppcon
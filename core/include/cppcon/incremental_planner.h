@@ -0,0 +1,345 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+// CppCon
+#include <cppcon/indexed_heap.h>
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Heuristic policy which bounds every distance by zero, which makes IncrementalPlanner an incremental Dijkstra
+ */
+struct ZeroHeuristic
+{
+  template<SearchGraph G>
+  void reset([[maybe_unused]] const G& graph, [[maybe_unused]] vertex_id_t target) {}
+
+  edge_weight_t operator()([[maybe_unused]] vertex_id_t q) const { return 0; }
+};
+
+
+/**
+ * Shortest path planner which repairs its last search after edges change or the start moves, rather than
+ * searching again from scratch (D* Lite [Koenig and Likhachev, 2002])
+ *
+ * The search runs backward from the goal. Every vertex keeps g, its distance to the goal as of its last
+ * expansion, and rhs, the smallest edge weight + g over its out-edges; only vertices where the two disagree
+ * are queued. An edge update re-evaluates rhs at the tail of the edge, so the next search expands only the
+ * vertices whose distance changed and which can still lie on a shortest path from the start.
+ *
+ * State is kept between searches for as long as the goal and the graph stay the same; the graph may change
+ * edge properties between searches, but not its vertices or edges, and each change must be passed to
+ * update_edges().
+ *
+ * \param HeuristicT  policy such that, after reset(graph, start), heuristic(q) is a lower bound on the
+ *                    distance from the start to q which satisfies the triangle inequality
+ */
+template<typename HeuristicT = ZeroHeuristic>
+class IncrementalPlanner
+{
+public:
+  static constexpr edge_weight_t kInfinite = std::numeric_limits<edge_weight_t>::max();
+
+  IncrementalPlanner() : queue_{HeapPosition{&heap_positions_}} {}
+
+  IncrementalPlanner(const IncrementalPlanner&) = delete;
+
+  IncrementalPlanner& operator=(const IncrementalPlanner&) = delete;
+
+  /**
+   * Sets the goal of the next search; changing it discards all state kept from previous searches
+   */
+  void set_goal(vertex_id_t g)
+  {
+    initialized_ = initialized_ and (g == goal_);
+    goal_ = g;
+  }
+
+  vertex_id_t goal() const { return goal_; }
+
+  /**
+   * Discards all state kept from previous searches, except predecessor lists, so the next search starts over
+   */
+  void clear() { initialized_ = false; }
+
+  /**
+   * Notifies the planner of edges of \c graph which have changed since its last search
+   *
+   * \c graph must already hold the new edge properties.
+   */
+  template<SearchGraph G>
+  void update_edges(const G& graph, std::span<const EdgeUpdate> updates)
+  {
+    if (!initialized_ or graph_ != &graph)
+    {
+      return;
+    }
+    for (const auto& update : updates)
+    {
+      update_vertex(graph, update.pred);
+    }
+  }
+
+  /**
+   * Returns the number of vertices expanded by the last search
+   */
+  std::size_t settled_count() const { return settled_count_; }
+
+  /**
+   * Returns the length of the path found by the last search
+   */
+  edge_weight_t path_length() const { return g_[start_]; }
+
+private:
+  template<SearchGraph G, typename H>
+  friend bool search(IncrementalPlanner<H>& ctx, const G& graph, vertex_id_t start);
+
+  template<typename OutputIteratorT, typename H>
+  friend OutputIteratorT get_reverse_path(OutputIteratorT out, const IncrementalPlanner<H>& ctx, vertex_id_t goal);
+
+  struct Key
+  {
+    std::uint64_t primary;
+    std::uint64_t secondary;
+
+    auto operator<=>(const Key&) const = default;
+  };
+
+  struct QueueEntry
+  {
+    Key key;
+    vertex_id_t vertex;
+  };
+
+  struct HeapPosition
+  {
+    std::vector<std::uint32_t>* positions;
+    std::uint32_t& operator()(vertex_id_t q) const { return (*positions)[q]; }
+  };
+
+  using Queue = IndexedDaryHeap<4, QueueEntry, &QueueEntry::key, &QueueEntry::vertex, HeapPosition>;
+
+  static constexpr edge_weight_t add(edge_weight_t lhs, edge_weight_t rhs)
+  {
+    return (lhs == kInfinite or rhs == kInfinite) ? kInfinite : (lhs + rhs);
+  }
+
+  Key key(vertex_id_t q) const
+  {
+    const edge_weight_t m = std::min(g_[q], rhs_[q]);
+    if (m == kInfinite)
+    {
+      return Key{.primary = std::numeric_limits<std::uint64_t>::max(), .secondary = std::numeric_limits<std::uint64_t>::max()};
+    }
+    return Key{.primary = std::uint64_t{m} + heuristic_(q) + key_modifier_, .secondary = m};
+  }
+
+  /**
+   * Discards all values and queues the goal; predecessors are only rebuilt for a different graph
+   */
+  template<SearchGraph G>
+  void initialize(const G& graph, vertex_id_t start)
+  {
+    const std::size_t n = graph.vertex_count();
+    if (graph_ != &graph or predecessor_offsets_.size() != n + 1)
+    {
+      // Count in-degrees, then scatter the tail of every edge, valid or not, into the list of its head
+      predecessor_offsets_.assign(n + 1, 0);
+      for (vertex_id_t u = 0; u < n; ++u)
+      {
+        graph.for_each_edge(u, [this](vertex_id_t v, const EdgeProperties&) { ++predecessor_offsets_[v + 1]; });
+      }
+      std::partial_sum(predecessor_offsets_.begin(), predecessor_offsets_.end(), predecessor_offsets_.begin());
+
+      std::vector<std::size_t> cursor{predecessor_offsets_.begin(), predecessor_offsets_.end() - 1};
+      predecessors_.resize(predecessor_offsets_.back());
+      for (vertex_id_t u = 0; u < n; ++u)
+      {
+        graph.for_each_edge(u, [this, &cursor, u](vertex_id_t v, const EdgeProperties&) { predecessors_[cursor[v]++] = u; });
+      }
+      graph_ = &graph;
+    }
+
+    queue_.clear();
+    heap_positions_.assign(n, Queue::kNotQueued);
+    g_.assign(n, kInfinite);
+    rhs_.assign(n, kInfinite);
+    key_modifier_ = 0;
+    heuristic_.reset(graph, start);
+
+    rhs_[goal_] = 0;
+    queue_.push_or_update(QueueEntry{.key = key(goal_), .vertex = goal_});
+    initialized_ = true;
+  }
+
+  /**
+   * Re-evaluates rhs of \c u from its out-edges, and queues \c u if it is inconsistent
+   */
+  template<SearchGraph G>
+  void update_vertex(const G& graph, vertex_id_t u)
+  {
+    if (u != goal_)
+    {
+      edge_weight_t best = kInfinite;
+      graph.for_each_edge(
+        u,
+        [this, &best](vertex_id_t v, const EdgeProperties& edge)
+        {
+          if (edge.valid)
+          {
+            best = std::min(best, add(edge.weight, g_[v]));
+          }
+        });
+      rhs_[u] = best;
+    }
+
+    if (g_[u] != rhs_[u])
+    {
+      queue_.push_or_update(QueueEntry{.key = key(u), .vertex = u});
+    }
+    else
+    {
+      queue_.erase(u);
+    }
+  }
+
+  template<SearchGraph G>
+  void update_predecessors(const G& graph, vertex_id_t v)
+  {
+    for (std::size_t i = predecessor_offsets_[v]; i < predecessor_offsets_[v + 1]; ++i)
+    {
+      update_vertex(graph, predecessors_[i]);
+    }
+  }
+
+  template<SearchGraph G>
+  void compute_shortest_path(const G& graph)
+  {
+    while (!queue_.empty() and (queue_.top().key < key(start_) or rhs_[start_] != g_[start_]))
+    {
+      const auto [old_key, u] = queue_.top();
+      if (const Key new_key = key(u); old_key < new_key)
+      {
+        // Queued before the start last moved
+        queue_.push_or_update(QueueEntry{.key = new_key, .vertex = u});
+      }
+      else if (g_[u] > rhs_[u])
+      {
+        // Distance has decreased, or was found for the first time
+        g_[u] = rhs_[u];
+        queue_.pop();
+        ++settled_count_;
+        update_predecessors(graph, u);
+      }
+      else
+      {
+        // Distance has increased; u is re-queued at its new rhs until it is settled again
+        g_[u] = kInfinite;
+        ++settled_count_;
+        update_vertex(graph, u);
+        update_predecessors(graph, u);
+      }
+    }
+  }
+
+  /**
+   * Follows, from the start, the out-edge which minimizes edge weight + g until the goal is reached
+   */
+  template<SearchGraph G>
+  bool extract_path(const G& graph)
+  {
+    path_.clear();
+    path_.push_back(start_);
+    for (vertex_id_t q = start_; q != goal_; path_.push_back(q))
+    {
+      edge_weight_t best = kInfinite;
+      vertex_id_t next = q;
+      graph.for_each_edge(
+        q,
+        [this, &best, &next](vertex_id_t v, const EdgeProperties& edge)
+        {
+          if (const edge_weight_t length = add(edge.weight, g_[v]); edge.valid and length < best)
+          {
+            best = length;
+            next = v;
+          }
+        });
+      if (best == kInfinite or path_.size() > graph.vertex_count())
+      {
+        return false;
+      }
+      q = next;
+    }
+    return true;
+  }
+
+  HeuristicT heuristic_;
+
+  vertex_id_t goal_ = 0;
+  vertex_id_t start_ = 0;
+
+  bool initialized_ = false;
+
+  const void* graph_ = nullptr;
+
+  std::vector<std::size_t> predecessor_offsets_;
+  std::vector<vertex_id_t> predecessors_;
+
+  std::vector<edge_weight_t> g_;
+  std::vector<edge_weight_t> rhs_;
+  std::vector<std::uint32_t> heap_positions_;
+
+  std::uint64_t key_modifier_ = 0;
+
+  Queue queue_;
+
+  std::size_t settled_count_ = 0;
+
+  std::vector<vertex_id_t> path_;
+};
+
+
+/**
+ * Plans from \c start to the goal of \c ctx, repairing the previous search where possible
+ */
+template<SearchGraph G, typename H>
+bool search(IncrementalPlanner<H>& ctx, const G& graph, vertex_id_t start)
+{
+  if (!ctx.initialized_ or ctx.graph_ != &graph)
+  {
+    ctx.initialize(graph, start);
+  }
+  else if (start != ctx.start_)
+  {
+    // Keys queued for the old start stay lower bounds once raised by the distance the start moved
+    ctx.key_modifier_ += ctx.heuristic_(start);
+    ctx.heuristic_.reset(graph, start);
+  }
+  ctx.start_ = start;
+  ctx.settled_count_ = 0;
+
+  ctx.compute_shortest_path(graph);
+  return (ctx.g_[start] != IncrementalPlanner<H>::kInfinite) and ctx.extract_path(graph);
+}
+
+
+/**
+ * Writes the path found by the last incremental search from the goal back to the start
+ */
+template<typename OutputIteratorT, typename H>
+OutputIteratorT get_reverse_path(OutputIteratorT out, const IncrementalPlanner<H>& ctx, [[maybe_unused]] vertex_id_t goal)
+{
+  return std::copy(ctx.path_.rbegin(), ctx.path_.rend(), out);
+}
+
+}  // namespace cppcon
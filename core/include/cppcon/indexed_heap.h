@@ -0,0 +1,210 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace cppcon
+{
+
+/**
+ * Min d-ary heap which holds at most one entry per ID and supports decrease-key
+ *
+ * The position of each ID's entry is stored outside of the heap, so that it can live alongside other
+ * per-vertex search state.
+ *
+ * \tparam Arity  children per node; 4 or 8 keep siblings within one or two cache lines
+ * \tparam KeyMember  pointer to the member of T which holds the key
+ * \tparam IdMember  pointer to the member of T which holds the ID
+ * \tparam PositionMapT  callable such that position_map(id) returns a reference to the stored position of id
+ */
+template<std::size_t Arity, typename T, auto KeyMember, auto IdMember, typename PositionMapT>
+class IndexedDaryHeap
+{
+public:
+  using position_type = std::uint32_t;
+
+  static constexpr position_type kNotQueued = std::numeric_limits<position_type>::max();
+
+  explicit IndexedDaryHeap(PositionMapT position_map = PositionMapT{}) :
+    position_map_{std::move(position_map)}
+  {}
+
+  bool empty() const { return entries_.empty(); }
+
+  std::size_t size() const { return entries_.size(); }
+
+  /**
+   * Removes all entries; positions of IDs which were still queued are reset to kNotQueued
+   */
+  void clear()
+  {
+    for (const auto& entry : entries_)
+    {
+      position_map_(entry.*IdMember) = kNotQueued;
+    }
+    entries_.clear();
+  }
+
+  const T& top() const { return entries_.front(); }
+
+  void pop()
+  {
+    position_map_(entries_.front().*IdMember) = kNotQueued;
+    if (entries_.size() > 1)
+    {
+      entries_.front() = std::move(entries_.back());
+      entries_.pop_back();
+      sift_down(0);
+    }
+    else
+    {
+      entries_.pop_back();
+    }
+  }
+
+  enum class Update
+  {
+    kInserted,
+    kDecreased,
+    kUnchanged
+  };
+
+  /**
+   * Inserts \c value if its ID is not queued, or replaces the queued entry if \c value has a smaller key
+   */
+  Update push_or_decrease(const T& value)
+  {
+    const position_type position = position_map_(value.*IdMember);
+    if (position == kNotQueued)
+    {
+      entries_.push_back(value);
+      sift_up(entries_.size() - 1);
+      return Update::kInserted;
+    }
+    else if (value.*KeyMember < entries_[position].*KeyMember)
+    {
+      entries_[position] = value;
+      sift_up(position);
+      return Update::kDecreased;
+    }
+    return Update::kUnchanged;
+  }
+
+  /**
+   * Inserts \c value if its ID is not queued, or replaces the queued entry whether its key is smaller or larger
+   */
+  void push_or_update(const T& value)
+  {
+    const position_type position = position_map_(value.*IdMember);
+    if (position == kNotQueued)
+    {
+      entries_.push_back(value);
+      sift_up(entries_.size() - 1);
+    }
+    else if (value.*KeyMember < entries_[position].*KeyMember)
+    {
+      entries_[position] = value;
+      sift_up(position);
+    }
+    else
+    {
+      entries_[position] = value;
+      sift_down(position);
+    }
+  }
+
+  /**
+   * Removes the entry of \c id, if it is queued
+   */
+  template<typename IdT>
+  void erase(const IdT& id)
+  {
+    const position_type position = position_map_(id);
+    if (position == kNotQueued)
+    {
+      return;
+    }
+
+    position_map_(id) = kNotQueued;
+    if (position + 1 == entries_.size())
+    {
+      entries_.pop_back();
+      return;
+    }
+
+    // Fill the hole with the last entry, which may belong either above or below it
+    entries_[position] = std::move(entries_.back());
+    entries_.pop_back();
+    if (position > 0 and entries_[position].*KeyMember < entries_[(position - 1) / Arity].*KeyMember)
+    {
+      sift_up(position);
+    }
+    else
+    {
+      sift_down(position);
+    }
+  }
+
+private:
+  void place(std::size_t position, T&& value)
+  {
+    position_map_(value.*IdMember) = static_cast<position_type>(position);
+    entries_[position] = std::move(value);
+  }
+
+  void sift_up(std::size_t position)
+  {
+    T value = std::move(entries_[position]);
+    while (position > 0)
+    {
+      const std::size_t parent = (position - 1) / Arity;
+      if (!(value.*KeyMember < entries_[parent].*KeyMember))
+      {
+        break;
+      }
+      place(position, std::move(entries_[parent]));
+      position = parent;
+    }
+    place(position, std::move(value));
+  }
+
+  void sift_down(std::size_t position)
+  {
+    T value = std::move(entries_[position]);
+    while (true)
+    {
+      const std::size_t first_child = position * Arity + 1;
+      if (first_child >= entries_.size())
+      {
+        break;
+      }
+
+      const std::size_t last_child = std::min(first_child + Arity, entries_.size());
+      std::size_t min_child = first_child;
+      for (std::size_t child = first_child + 1; child < last_child; ++child)
+      {
+        if (entries_[child].*KeyMember < entries_[min_child].*KeyMember)
+        {
+          min_child = child;
+        }
+      }
+
+      if (!(entries_[min_child].*KeyMember < value.*KeyMember))
+      {
+        break;
+      }
+      place(position, std::move(entries_[min_child]));
+      position = min_child;
+    }
+    place(position, std::move(value));
+  }
+
+  PositionMapT position_map_;
+  std::vector<T> entries_;
+};
+
+}  // namespace cppcon
@@ -0,0 +1,161 @@
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+// CppCon
+#include <cppcon/prefetch.h>
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Runs many independent searches at once, one per context in \c lanes, interleaving their steps so that
+ * the cache misses of one search overlap with work on the others (asynchronous memory access chaining)
+ *
+ * Each search runs the same loop as resume_search(), split into stages at every point where it would stall
+ * on memory: after de-queuing a vertex, its visited state and adjacency are prefetched; once it is settled,
+ * its edges are prefetched; then the visited state of its children; and only then is it expanded. Between
+ * stages, control moves on to the next lane, which gives every prefetch as many stages of other searches to
+ * complete in as there are lanes. Graphs and contexts without prefetch hints are still interleaved.
+ *
+ * Every lane keeps its context for as long as it runs, so each search produces exactly the result it would
+ * if run on its own.
+ *
+ * \param query  fn(i) returning the {start, goal} of query i, for i in [0, query_count)
+ * \param on_result  fn(i, ctx, found) called as soon as query i finishes, while \c ctx still holds its result
+ */
+template<SearchContext C, SearchGraph G, typename QueryFnT, typename ResultFnT>
+void search_interleaved(std::span<C> lanes, const G& graph, std::size_t query_count, QueryFnT&& query, ResultFnT&& on_result)
+{
+  enum class Stage
+  {
+    kIdle,
+    kDequeue,
+    kSettle,
+    kPrefetchChildren,
+    kExpand,
+  };
+
+  struct LaneState
+  {
+    Stage stage = Stage::kIdle;
+    std::size_t query = 0;
+    Transition transition = {};
+  };
+
+  std::vector<LaneState> states(lanes.size());
+  std::size_t next_query = 0;
+  std::size_t active_count = 0;
+
+  const auto start_next = [&](C& ctx, LaneState& state)
+  {
+    if (next_query == query_count)
+    {
+      state.stage = Stage::kIdle;
+      return;
+    }
+    state.query = next_query++;
+    state.stage = Stage::kDequeue;
+    const auto [start, goal] = query(state.query);
+    ctx.set_goal(goal);
+    ctx.reset(graph, start);
+  };
+
+  const auto finish = [&](C& ctx, LaneState& state, bool found)
+  {
+    on_result(state.query, ctx, found);
+    start_next(ctx, state);
+    active_count -= (state.stage == Stage::kIdle);
+  };
+
+  // De-queues the next transition and prefetches what settling its successor will read
+  const auto dequeue = [&](C& ctx, LaneState& state)
+  {
+    if (!ctx.is_queue_not_empty())
+    {
+      finish(ctx, state, false);
+      return;
+    }
+    state.transition = ctx.dequeue();
+    if constexpr (PrefetchingSearchContext<C>)
+    {
+      ctx.prefetch_visited(state.transition.succ);
+    }
+    if constexpr (PrefetchingSearchGraph<G>)
+    {
+      graph.prefetch_adjacency(state.transition.succ);
+    }
+    state.stage = Stage::kSettle;
+  };
+
+  for (std::size_t l = 0; l < lanes.size(); ++l)
+  {
+    start_next(lanes[l], states[l]);
+    active_count += (states[l].stage != Stage::kIdle);
+  }
+
+  while (active_count > 0)
+  {
+    for (std::size_t l = 0; l < lanes.size(); ++l)
+    {
+      auto& ctx = lanes[l];
+      auto& state = states[l];
+      const vertex_id_t q = state.transition.succ;
+      switch (state.stage)
+      {
+        case Stage::kIdle:
+        {
+          break;
+        }
+        case Stage::kDequeue:
+        {
+          dequeue(ctx, state);
+          break;
+        }
+        case Stage::kSettle:
+        {
+          if (ctx.is_visited(q))
+          {
+            // Stale entry; its successor's fetch is what this stage waits on, so move on at once
+            dequeue(ctx, state);
+            break;
+          }
+          ctx.mark_visited(state.transition.pred, q);
+          if (ctx.is_terminal(q))
+          {
+            finish(ctx, state, true);
+            break;
+          }
+          if constexpr (PrefetchingSearchGraph<G>)
+          {
+            graph.prefetch_edges(q);
+          }
+          state.stage = Stage::kPrefetchChildren;
+          break;
+        }
+        case Stage::kPrefetchChildren:
+        {
+          if constexpr (PrefetchingSearchContext<C>)
+          {
+            graph.for_each_edge(q, [&ctx](vertex_id_t child, const EdgeProperties&) { ctx.prefetch_visited(child); });
+          }
+          state.stage = Stage::kExpand;
+          break;
+        }
+        case Stage::kExpand:
+        {
+          expand(ctx, graph, q, state.transition.weight);
+          state.stage = Stage::kDequeue;
+          break;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace cppcon
@@ -0,0 +1,407 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/transpose.h>
+
+namespace cppcon
+{
+
+/**
+ * Shortest-path tree rooted at a source vertex, with the distance of every vertex it reaches
+ *
+ * A SearchContext which never terminates, like GoalTree; vertices are also recorded in the order in which
+ * they were settled, which is an order of non-decreasing distance.
+ */
+class DistanceTree
+{
+public:
+  static constexpr edge_weight_t kUnreached = std::numeric_limits<edge_weight_t>::max();
+
+  template<SearchGraph G>
+  void reset(G&& graph, vertex_id_t source)
+  {
+    queue_ = {};
+    distance_.assign(graph.vertex_count(), kUnreached);
+    predecessor_.resize(graph.vertex_count());
+    settled_.clear();
+    enqueue(source, source, 0);
+  }
+
+  edge_weight_t distance(vertex_id_t q) const { return distance_[q]; }
+
+  /**
+   * Returns the vertices reached from the source, in the order in which they were settled
+   */
+  const std::vector<vertex_id_t>& settled() const { return settled_; }
+
+  bool is_queue_not_empty() const { return !queue_.empty(); }
+
+  bool is_visited(vertex_id_t q) const { return distance_[q] != kUnreached; }
+
+  bool is_terminal([[maybe_unused]] vertex_id_t q) const { return false; }
+
+  void mark_visited(vertex_id_t p, vertex_id_t s)
+  {
+    distance_[s] = settling_;
+    predecessor_[s] = p;
+    settled_.push_back(s);
+  }
+
+  vertex_id_t predecessor(vertex_id_t q) const { return predecessor_[q]; }
+
+  Transition dequeue()
+  {
+    auto t = queue_.top();
+    queue_.pop();
+    settling_ = t.weight;
+    return t;
+  }
+
+  void enqueue(vertex_id_t p, vertex_id_t s, edge_weight_t w)
+  {
+    queue_.push(Transition{
+      .pred = p,
+      .succ = s,
+      .weight = w
+    });
+  }
+
+private:
+  std::priority_queue<Transition, std::vector<Transition>, std::greater<Transition>> queue_;
+
+  edge_weight_t settling_ = 0;
+
+  std::vector<edge_weight_t> distance_;
+  std::vector<vertex_id_t> predecessor_;
+  std::vector<vertex_id_t> settled_;
+};
+
+
+enum class LandmarkSelection
+{
+  /// Each landmark is the vertex farthest from all landmarks chosen before it
+  kFarthest,
+  /// Each landmark is the leaf of the subtree of a random shortest-path tree which is worst covered by the landmarks
+  /// chosen before it [Goldberg and Werneck, 2005]
+  kAvoid
+};
+
+
+/**
+ * Distances from and to a small set of landmark vertices, for ALT (A*, landmarks, triangle inequality)
+ *
+ * By the triangle inequality, d(q, g) >= d(L, g) - d(L, q) and d(q, g) >= d(q, L) - d(g, L) for every landmark
+ * L, which gives a consistent lower bound on the remaining distance that follows detours which straight-line
+ * distance cannot see. Distances are stored per vertex, so evaluating the bound for a vertex reads one
+ * contiguous row of 2 * landmark_count() weights.
+ */
+class LandmarkTable
+{
+public:
+  static constexpr edge_weight_t kUnreached = DistanceTree::kUnreached;
+
+  LandmarkTable() = default;
+
+  /**
+   * Selects \c landmark_count landmarks and computes their distance tables
+   *
+   * Selection runs one forward search per landmark, since each choice depends on the ones before it; the
+   * backward searches are then split across \c thread_count threads.
+   */
+  template<SearchGraph G>
+  LandmarkTable(
+    const G& graph,
+    std::size_t landmark_count,
+    LandmarkSelection selection,
+    std::size_t thread_count,
+    std::size_t seed = 1) :
+    landmark_count_{std::min(landmark_count, graph.vertex_count())},
+    distances_(graph.vertex_count() * landmark_count_ * 2, kUnreached)
+  {
+    std::mt19937 rng{static_cast<std::mt19937::result_type>(seed)};
+    std::uniform_int_distribution<vertex_id_t> random_vertex{0, static_cast<vertex_id_t>(graph.vertex_count() - 1)};
+
+    DistanceTree tree;
+    for (std::size_t i = 0; i < landmark_count_; ++i)
+    {
+      const vertex_id_t landmark = (selection == LandmarkSelection::kFarthest) ?
+                                   select_farthest(graph, tree, random_vertex(rng), i) :
+                                   select_avoid(graph, tree, random_vertex(rng), i);
+      landmarks_.push_back(landmark);
+
+      search(tree, graph, landmark);
+      for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+      {
+        from_landmark(q, i) = tree.distance(q);
+      }
+    }
+
+    const TransposedGraph<G> reverse_graph{graph};
+    const auto work = [&](std::size_t thread_index)
+    {
+      DistanceTree reverse_tree;
+      for (std::size_t i = thread_index; i < landmark_count_; i += thread_count)
+      {
+        search(reverse_tree, reverse_graph, landmarks_[i]);
+        for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+        {
+          to_landmark(q, i) = reverse_tree.distance(q);
+        }
+      }
+    };
+
+    thread_count = std::clamp<std::size_t>(thread_count, 1, std::max<std::size_t>(1, landmark_count_));
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count - 1);
+    for (std::size_t thread_index = 1; thread_index < thread_count; ++thread_index)
+    {
+      threads.emplace_back(work, thread_index);
+    }
+    work(0);
+  }
+
+  std::size_t landmark_count() const { return landmark_count_; }
+
+  const std::vector<vertex_id_t>& landmarks() const { return landmarks_; }
+
+  /**
+   * Returns d(L_i, q)
+   */
+  edge_weight_t from_landmark(vertex_id_t q, std::size_t i) const { return distances_[(q * landmark_count_ + i) * 2]; }
+
+  /**
+   * Returns d(q, L_i)
+   */
+  edge_weight_t to_landmark(vertex_id_t q, std::size_t i) const { return distances_[(q * landmark_count_ + i) * 2 + 1]; }
+
+  /**
+   * Returns the best landmark lower bound on d(q, g)
+   */
+  edge_weight_t lower_bound(vertex_id_t q, vertex_id_t g) const
+  {
+    return lower_bound(row(q), row(g));
+  }
+
+  /**
+   * Returns the best landmark lower bound between two rows of the table, as returned by row()
+   */
+  edge_weight_t lower_bound(const edge_weight_t* q_row, const edge_weight_t* g_row) const
+  {
+    std::int64_t bound = 0;
+    for (std::size_t i = 0; i < landmark_count_ * 2; i += 2)
+    {
+      if (q_row[i] != kUnreached and g_row[i] != kUnreached)
+      {
+        bound = std::max<std::int64_t>(bound, std::int64_t{g_row[i]} - std::int64_t{q_row[i]});
+      }
+      if (q_row[i + 1] != kUnreached and g_row[i + 1] != kUnreached)
+      {
+        bound = std::max<std::int64_t>(bound, std::int64_t{q_row[i + 1]} - std::int64_t{g_row[i + 1]});
+      }
+    }
+    return static_cast<edge_weight_t>(bound);
+  }
+
+  /**
+   * Returns the distances of \c q, interleaved as d(L_0, q), d(q, L_0), d(L_1, q), ...
+   */
+  const edge_weight_t* row(vertex_id_t q) const { return &distances_[q * landmark_count_ * 2]; }
+
+  /**
+   * Relabels vertices, such that vertex q becomes vertex indices[q], as Graph::shuffle does
+   */
+  void shuffle(const std::vector<std::size_t>& indices)
+  {
+    const std::size_t row_size = landmark_count_ * 2;
+    std::vector<edge_weight_t> distances(distances_.size());
+    for (std::size_t q = 0; q < indices.size(); ++q)
+    {
+      std::copy_n(distances_.begin() + q * row_size, row_size, distances.begin() + indices[q] * row_size);
+    }
+    distances_ = std::move(distances);
+    std::for_each(landmarks_.begin(), landmarks_.end(), [&indices](vertex_id_t& q) { q = indices[q]; });
+  }
+
+private:
+  edge_weight_t& from_landmark(vertex_id_t q, std::size_t i) { return distances_[(q * landmark_count_ + i) * 2]; }
+
+  edge_weight_t& to_landmark(vertex_id_t q, std::size_t i) { return distances_[(q * landmark_count_ + i) * 2 + 1]; }
+
+  /**
+   * Returns the reachable vertex with the largest distance to its nearest landmark among the first \c selected
+   */
+  template<SearchGraph G>
+  vertex_id_t select_farthest(const G& graph, DistanceTree& tree, vertex_id_t root, std::size_t selected) const
+  {
+    if (selected == 0)
+    {
+      search(tree, graph, root);
+      return tree.settled().back();
+    }
+
+    vertex_id_t farthest = landmarks_.front();
+    edge_weight_t farthest_distance = 0;
+    for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+    {
+      edge_weight_t nearest = kUnreached;
+      for (std::size_t i = 0; i < selected; ++i)
+      {
+        nearest = std::min(nearest, from_landmark(q, i));
+      }
+      if (nearest != kUnreached and nearest > farthest_distance)
+      {
+        farthest = q;
+        farthest_distance = nearest;
+      }
+    }
+    return farthest;
+  }
+
+  /**
+   * Grows a shortest-path tree from \c root and descends into the subtree whose distances are worst
+   * approximated by the first \c selected landmarks, returning the leaf it ends at
+   *
+   * Subtrees which already contain a landmark are never entered.
+   */
+  template<SearchGraph G>
+  vertex_id_t select_avoid(const G& graph, DistanceTree& tree, vertex_id_t root, std::size_t selected) const
+  {
+    search(tree, graph, root);
+
+    // Only forward distances are known at this point; d(L, q) - d(L, root) also bounds d(root, q)
+    const auto bound = [this, root, selected](vertex_id_t q)
+    {
+      std::int64_t b = 0;
+      for (std::size_t i = 0; i < selected; ++i)
+      {
+        if (from_landmark(q, i) != kUnreached and from_landmark(root, i) != kUnreached)
+        {
+          b = std::max<std::int64_t>(b, std::int64_t{from_landmark(q, i)} - std::int64_t{from_landmark(root, i)});
+        }
+      }
+      return b;
+    };
+
+    std::vector<std::int64_t> size(graph.vertex_count(), 0);
+    std::vector<bool> covered(graph.vertex_count(), false);
+    for (std::size_t i = 0; i < selected; ++i)
+    {
+      covered[landmarks_[i]] = true;
+    }
+
+    // Children are settled after their parents, so sizes accumulate bottom-up in reverse settling order
+    const auto& settled = tree.settled();
+    for (auto itr = settled.rbegin(); itr != settled.rend(); ++itr)
+    {
+      const vertex_id_t q = *itr;
+      const vertex_id_t p = tree.predecessor(q);
+      if (!covered[q])
+      {
+        size[q] += std::int64_t{tree.distance(q)} - bound(q);
+      }
+      else
+      {
+        size[q] = 0;
+      }
+
+      if (p != q)
+      {
+        covered[p] = covered[p] or covered[q];
+        size[p] += size[q];
+      }
+    }
+
+    std::vector<vertex_id_t> best_child(graph.vertex_count(), root);
+    for (const vertex_id_t q : settled)
+    {
+      const vertex_id_t p = tree.predecessor(q);
+      if (p != q and !covered[q] and (best_child[p] == root or size[q] > size[best_child[p]]))
+      {
+        best_child[p] = q;
+      }
+    }
+
+    vertex_id_t leaf = root;
+    while (best_child[leaf] != root)
+    {
+      leaf = best_child[leaf];
+    }
+    return leaf;
+  }
+
+  std::size_t landmark_count_ = 0;
+  std::vector<vertex_id_t> landmarks_;
+  std::vector<edge_weight_t> distances_;
+};
+
+
+template <typename T>
+concept LandmarkSearchGraph =
+  SearchGraph<T> and
+  requires(T&& g)
+  {
+      { g.landmarks() } -> std::convertible_to<const LandmarkTable&>;
+  };
+
+
+/**
+ * A* heuristic policy which bounds the remaining distance with the landmark table of the graph
+ */
+template<LandmarkSearchGraph G>
+class LandmarkHeuristic
+{
+public:
+  void reset(const G& graph, vertex_id_t goal)
+  {
+    table_ = &graph.landmarks();
+    goal_row_ = table_->row(goal);
+  }
+
+  edge_weight_t operator()(vertex_id_t q) const
+  {
+    return table_->lower_bound(table_->row(q), goal_row_);
+  }
+
+private:
+  const LandmarkTable* table_ = nullptr;
+  const edge_weight_t* goal_row_ = nullptr;
+};
+
+
+/**
+ * Heuristic policy which bounds the distance from a source with the landmark table of the graph, for searches
+ * which run backward from the goal, such as IncrementalPlanner
+ */
+template<LandmarkSearchGraph G>
+class LandmarkSourceHeuristic
+{
+public:
+  void reset(const G& graph, vertex_id_t source)
+  {
+    table_ = &graph.landmarks();
+    source_row_ = table_->row(source);
+  }
+
+  edge_weight_t operator()(vertex_id_t q) const
+  {
+    return table_->lower_bound(source_row_, table_->row(q));
+  }
+
+private:
+  const LandmarkTable* table_ = nullptr;
+  const edge_weight_t* source_row_ = nullptr;
+};
+
+}  // namespace cppcon
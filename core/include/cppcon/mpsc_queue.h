@@ -0,0 +1,72 @@
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace cppcon
+{
+
+/**
+ * Lock-free queue into which any number of threads push, and from which one thread takes everything at once
+ *
+ * Producers link each item onto an intrusive stack with a single compare-and-swap. The consumer detaches the
+ * whole stack with a single exchange, so no node is ever removed while a producer may be reading it (which
+ * is what makes a stack with concurrent pops subject to ABA). Items are taken newest first; users which need
+ * order should batch items into T themselves.
+ */
+template<typename T>
+class MpscQueue
+{
+public:
+  MpscQueue() = default;
+
+  MpscQueue(const MpscQueue&) = delete;
+
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  ~MpscQueue()
+  {
+    consume_all([](T&&) {});
+  }
+
+  /**
+   * Pushes \c value; may be called from any thread
+   */
+  void push(T value)
+  {
+    Node* const node = new Node{std::move(value), head_.load(std::memory_order_relaxed)};
+    while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /**
+   * Invokes fn(T&&) on every item pushed so far, newest first; must only be called by the consumer
+   *
+   * \return the number of items consumed
+   */
+  template<typename ConsumeFnT>
+  std::size_t consume_all(ConsumeFnT&& fn)
+  {
+    std::size_t count = 0;
+    for (Node* node = head_.exchange(nullptr, std::memory_order_acquire); node != nullptr; ++count)
+    {
+      fn(std::move(node->value));
+      delete std::exchange(node, node->next);
+    }
+    return count;
+  }
+
+  bool empty() const { return head_.load(std::memory_order_acquire) == nullptr; }
+
+private:
+  struct Node
+  {
+    T value;
+    Node* next;
+  };
+
+  std::atomic<Node*> head_ = nullptr;
+};
+
+}  // namespace cppcon
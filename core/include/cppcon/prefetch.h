@@ -0,0 +1,83 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <span>
+
+// CppCon
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Graph which can hint that the edges of a vertex will soon be visited
+ *
+ * prefetch_adjacency(q) fetches whatever locates the edges of q; prefetch_edges(q) reads it, so it should be
+ * called once that fetch has had time to complete, and fetches the edges themselves.
+ */
+template <typename T>
+concept PrefetchingSearchGraph =
+  SearchGraph<T> and
+  requires(const T& g)
+  {
+      { g.prefetch_adjacency(vertex_id_t{}) };
+      { g.prefetch_edges(vertex_id_t{}) };
+  };
+
+
+/**
+ * Context which can hint that the visited state of a vertex will soon be read
+ */
+template <typename T>
+concept PrefetchingSearchContext =
+  SearchContext<T> and
+  requires(const T& ctx)
+  {
+      { ctx.prefetch_visited(vertex_id_t{}) };
+  };
+
+
+/**
+ * Prefetch policy of contexts which never prefetch; they compile to exactly what they would without a policy
+ */
+struct NoPrefetch
+{
+  static constexpr bool kEnabled = false;
+};
+
+
+/**
+ * Prefetch policy of contexts queued on a binary heap, which, after every de-queue, looks at the first
+ * kLookahead heap entries: the next vertex to be de-queued and the few which most likely follow it
+ *
+ * For the next vertex, whose adjacency was most likely prefetched while it was still further down the
+ * heap, the edges and visited state are prefetched. For the others, the adjacency and visited state are.
+ */
+template<std::size_t kLookahead>
+struct HeapTopPrefetch
+{
+  static_assert(kLookahead > 0);
+
+  static constexpr bool kEnabled = true;
+
+  template<PrefetchingSearchGraph G>
+  static void prefetch(std::span<const Transition> heap, const G& graph, const vertex_id_t* visited)
+  {
+    if (heap.empty())
+    {
+      return;
+    }
+
+    graph.prefetch_edges(heap.front().succ);
+    __builtin_prefetch(visited + heap.front().succ);
+    for (std::size_t i = 1; i < std::min(kLookahead, heap.size()); ++i)
+    {
+      graph.prefetch_adjacency(heap[i].succ);
+      __builtin_prefetch(visited + heap[i].succ);
+    }
+  }
+};
+
+}  // namespace cppcon
@@ -0,0 +1,106 @@
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace cppcon
+{
+
+/**
+ * Monotone radix heap over unsigned 32-bit keys
+ *
+ * Valid as long as no pushed key is smaller than the last popped key, which holds for Dijkstra's algorithm
+ * with non-negative edge weights. Values are placed in the bucket given by the highest bit in which their
+ * key differs from the last popped key; a pop only redistributes the first non-empty bucket, so every value
+ * moves at most once per bucket index, giving amortized O(1) push and O(log C) pop.
+ *
+ * \tparam KeyMember  pointer to the member of T which holds the key
+ */
+template<typename T, auto KeyMember = &T::weight>
+class RadixHeap
+{
+public:
+  using key_type = std::uint32_t;
+
+  bool empty() const { return size_ == 0; }
+
+  std::size_t size() const { return size_; }
+
+  void clear()
+  {
+    for (auto& bucket : buckets_)
+    {
+      bucket.clear();
+    }
+    size_ = 0;
+    last_ = 0;
+  }
+
+  void push(const T& value)
+  {
+    buckets_[bucket_index(value.*KeyMember)].push_back(value);
+    ++size_;
+  }
+
+  const T& top()
+  {
+    refill();
+    return buckets_.front().back();
+  }
+
+  void pop()
+  {
+    refill();
+    buckets_.front().pop_back();
+    --size_;
+  }
+
+private:
+  static constexpr std::size_t kBucketCount = std::numeric_limits<key_type>::digits + 1;
+
+  std::size_t bucket_index(key_type key) const
+  {
+    return (key == last_) ? 0 : (std::numeric_limits<key_type>::digits - std::countl_zero(key ^ last_));
+  }
+
+  /**
+   * Ensures that bucket 0 holds the values with the smallest key
+   */
+  void refill()
+  {
+    if (!buckets_.front().empty())
+    {
+      return;
+    }
+
+    std::size_t i = 1;
+    while (buckets_[i].empty())
+    {
+      ++i;
+    }
+
+    auto& bucket = buckets_[i];
+    last_ = std::numeric_limits<key_type>::max();
+    for (const auto& value : bucket)
+    {
+      last_ = std::min<key_type>(last_, value.*KeyMember);
+    }
+
+    // Every value lands in a strictly lower bucket than i
+    for (const auto& value : bucket)
+    {
+      buckets_[bucket_index(value.*KeyMember)].push_back(value);
+    }
+    bucket.clear();
+  }
+
+  std::array<std::vector<T>, kBucketCount> buckets_;
+  std::size_t size_ = 0;
+  key_type last_ = 0;
+};
+
+}  // namespace cppcon
@@ -3,6 +3,7 @@
 // C++ Standard Library
 #include <type_traits>
 #include <limits>
+#include <optional>
 #include <utility>
 
 namespace cppcon
@@ -32,6 +33,16 @@ struct Transition
 
 constexpr bool operator>(const Transition& lhs, const Transition& rhs) { return lhs.weight > rhs.weight; }
 
+/**
+ * New properties for the edges from \c pred to \c succ; an invalid edge is closed
+ */
+struct EdgeUpdate
+{
+  vertex_id_t pred;
+  vertex_id_t succ;
+  EdgeProperties edge;
+};
+
 
 template <typename T>
 concept SearchGraph = 
@@ -58,53 +69,83 @@ concept SearchContext =
 
 
 
+/**
+ * Enqueues all unvisited children of the vertex \c q, which was settled at \c total_weight
+ */
 template<SearchContext C, SearchGraph G>
-bool search(C& ctx, const G& graph, vertex_id_t start)
+void expand(C& ctx, const G& graph, vertex_id_t q, edge_weight_t total_weight)
 {
-  ctx.reset(graph, start);
+  // Iterate over all edges from 'q'
+  graph.for_each_edge(
+    q,
+    [&ctx, total_weight, parent=q](vertex_id_t child, const EdgeProperties& edge) mutable
+    {
+      if (!edge.valid or ctx.is_visited(child))
+      {
+        return;
+      }
+      else
+      {
+        ctx.enqueue(parent, child, edge.weight + total_weight);
+      }
+    });
+}
 
+
+/**
+ * Continues searching from the current queue of \c ctx until a terminal vertex is settled
+ *
+ * The terminal vertex is marked visited but not expanded, so that the search may be resumed past it by
+ * expanding it first (see SearchSession).
+ *
+ * \return the transition which settled the terminal vertex, if one was reached
+ */
+template<SearchContext C, SearchGraph G>
+std::optional<Transition> resume_search(C& ctx, const G& graph)
+{
   while (ctx.is_queue_not_empty())
   {
     // De-queue successor vertex with the next smallest total weight
-    const auto [pred, succ, total_weight] = ctx.dequeue();
+    const Transition transition = ctx.dequeue();
+
+    // Contexts with a prefetch policy start fetching what the next few vertices to settle will read
+    if constexpr (requires { ctx.prefetch_frontier(graph); })
+    {
+      ctx.prefetch_frontier(graph);
+    }
 
     // Skip successor if it has been visited
-    if (ctx.is_visited(succ))
+    if (ctx.is_visited(transition.succ))
     {
       continue;
     }
     else
     {
       // Mark this successor vertex as visited
-      ctx.mark_visited(pred, succ);
+      ctx.mark_visited(transition.pred, transition.succ);
     }
 
     // Stop the search if successor is a terminal state
-    if (ctx.is_terminal(succ))
+    if (ctx.is_terminal(transition.succ))
     {
-      return true;
+      return transition;
     }
     else
     {
-      // Iterate over all edges from 'succ'
-      graph.for_each_edge(
-        succ,
-        [&ctx, total_weight, parent=succ](vertex_id_t child, const EdgeProperties& edge) mutable
-        {
-          if (!edge.valid or ctx.is_visited(child))
-          {
-            return;
-          }
-          else
-          {
-            ctx.enqueue(parent, child, edge.weight + total_weight);
-          }
-        });
+      expand(ctx, graph, transition.succ, transition.weight);
     }
   }
 
   // Terminal condition not met
-  return false;
+  return std::nullopt;
+}
+
+
+template<SearchContext C, SearchGraph G>
+bool search(C& ctx, const G& graph, vertex_id_t start)
+{
+  ctx.reset(graph, start);
+  return resume_search(ctx, graph).has_value();
 }
 
 
@@ -0,0 +1,73 @@
+#pragma once
+
+// C++ Standard Library
+#include <memory>
+#include <optional>
+
+// CppCon
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Single-source search which is resumed, rather than restarted, for each successive goal
+ *
+ * The frontier and settled set of the context are kept between queries. A goal which was already settled
+ * by an earlier query is answered at once; otherwise the search continues from where the last query
+ * stopped until the new goal is settled. Answering k goals from one start therefore costs at most one
+ * search to the farthest of them.
+ *
+ * Only valid for contexts whose queue order does not depend on the goal (i.e. Dijkstra, not A*), and whose
+ * goal is changed with \c set_goal.
+ */
+template<SearchContext C, SearchGraph G>
+class SearchSession
+{
+public:
+  SearchSession(C& ctx, const G& graph) :
+    ctx_{std::addressof(ctx)},
+    graph_{std::addressof(graph)}
+  {}
+
+  /**
+   * Discards all search state and starts a new session from \c start
+   */
+  void start(vertex_id_t start)
+  {
+    ctx_->reset(*graph_, start);
+    paused_at_.reset();
+  }
+
+  /**
+   * Settles \c goal, resuming the search if needed
+   *
+   * \return true if a path to \c goal exists; it is then read with get_reverse_path(out, context(), goal)
+   */
+  bool find(vertex_id_t goal)
+  {
+    ctx_->set_goal(goal);
+    if (ctx_->is_visited(goal))
+    {
+      return true;
+    }
+
+    // The last query stopped on its goal before expanding it
+    if (paused_at_.has_value())
+    {
+      expand(*ctx_, *graph_, paused_at_->succ, paused_at_->weight);
+    }
+
+    paused_at_ = resume_search(*ctx_, *graph_);
+    return paused_at_.has_value();
+  }
+
+  const C& context() const { return *ctx_; }
+
+private:
+  C* ctx_;
+  const G* graph_;
+  std::optional<Transition> paused_at_;
+};
+
+}  // namespace cppcon
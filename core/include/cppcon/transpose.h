@@ -0,0 +1,100 @@
+#pragma once
+
+// C++ Standard Library
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+
+namespace cppcon
+{
+
+/**
+ * Graph with every edge of another graph reversed, stored as CSR
+ *
+ * Searching from a vertex of the transposed graph finds paths which lead <em>to</em> that vertex in the
+ * original graph. Vertex properties are read from the original graph, which must outlive this one and
+ * must not be re-ordered while it is in use.
+ */
+template<SearchGraph G>
+class TransposedGraph
+{
+public:
+  explicit TransposedGraph(const G& graph) :
+    graph_{std::addressof(graph)},
+    offsets_(graph.vertex_count() + 1, 0)
+  {
+    const std::size_t n = graph.vertex_count();
+
+    // Count in-degrees, then turn them into offsets
+    for (vertex_id_t u = 0; u < n; ++u)
+    {
+      graph.for_each_edge(u, [this](vertex_id_t v, const EdgeProperties&) { ++offsets_[v + 1]; });
+    }
+    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+    // Scatter each edge (u, v) into the adjacency of v
+    std::vector<std::size_t> cursor{offsets_.begin(), offsets_.end() - 1};
+    edges_.resize(offsets_.back(), Edge{0, EdgeProperties{0}});
+    for (vertex_id_t u = 0; u < n; ++u)
+    {
+      graph.for_each_edge(
+        u,
+        [this, &cursor, u](vertex_id_t v, const EdgeProperties& edge)
+        {
+          edges_[cursor[v]++] = Edge{u, edge};
+        });
+    }
+  }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& edge_visitor) const
+  {
+    for (std::size_t i = offsets_[q]; i < offsets_[q + 1]; ++i)
+    {
+      edge_visitor(edges_[i].first, edges_[i].second);
+    }
+  }
+
+  decltype(auto) vertex(vertex_id_t q) const { return graph_->vertex(q); }
+
+  /**
+   * Gives every reversed edge from pred to succ of each update its new properties, as the original graph's
+   * update_edges() does to the original edge
+   *
+   * \return the number of updates which matched no edge
+   */
+  std::size_t update_edges(std::span<const EdgeUpdate> updates)
+  {
+    std::size_t unmatched = 0;
+    for (const auto& update : updates)
+    {
+      bool matched = false;
+      if (update.succ < vertex_count())
+      {
+        for (std::size_t i = offsets_[update.succ]; i < offsets_[update.succ + 1]; ++i)
+        {
+          if (edges_[i].first == update.pred)
+          {
+            edges_[i].second = update.edge;
+            matched = true;
+          }
+        }
+      }
+      unmatched += !matched;
+    }
+    return unmatched;
+  }
+
+  std::size_t vertex_count() const { return offsets_.size() - 1; }
+
+private:
+  const G* graph_;
+  std::vector<std::size_t> offsets_;
+  std::vector<Edge> edges_;
+};
+
+}  // namespace cppcon
@@ -9,6 +9,7 @@
 #include <vector>
 
 // CppCon
+#include <cppcon/prefetch.h>
 #include <cppcon/search.h>
 
 namespace cppcon::demo::a3
@@ -20,9 +21,14 @@ struct MinQueue : std::priority_queue<T, std::vector<T>, std::greater<T>>
   using Base = std::priority_queue<T, std::vector<T>, std::greater<T>>;
   using Base::Base;
   std::vector<T>& underlying() { return Base::c; }
+  const std::vector<T>& underlying() const { return Base::c; }
 };
 
-class TerminateAtGoal
+/**
+ * \param PrefetchT  policy which chooses what to prefetch from the queue after every de-queue (see HeapTopPrefetch)
+ */
+template<typename PrefetchT = NoPrefetch>
+class BasicTerminateAtGoal
 {
 public:
   void set_goal(vertex_id_t g) { goal_ = g; }
@@ -64,6 +70,16 @@ public:
     return visited_[q];
   }
 
+  /**
+   * Prefetches what settling the next few queued vertices will read, as chosen by PrefetchT
+   */
+  template<PrefetchingSearchGraph G>
+    requires PrefetchT::kEnabled
+  void prefetch_frontier(const G& graph) const
+  {
+    PrefetchT::prefetch(queue_.underlying(), graph, visited_.data());
+  }
+
   Transition dequeue()
   {
     auto t = queue_.top();
@@ -90,5 +106,6 @@ private:
   std::vector<edge_weight_t> heuristic_;
 };
 
+using TerminateAtGoal = BasicTerminateAtGoal<>;
 
 }  // namespace cppcon::demo::a3
\ No newline at end of file
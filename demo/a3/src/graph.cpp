@@ -3,42 +3,29 @@
 
 // CppCon
 #include <cppcon/demo/a3/graph.h>
-#include <cppcon/demo/json.h>
+#include <cppcon/demo/graph_json.h>
+#include <cppcon/demo/permute.h>
 
 namespace cppcon::demo::a3
 {
 
 Graph::Graph(const std::filesystem::path& graph_file_name)
 {
-  const auto v = load_json(graph_file_name);
-  const auto& root = v.get<picojson::object>();
-  const auto& nodes = root.at("nodes").get<picojson::array>();
+  const GraphJsonReader reader{graph_file_name};
 
-  this->vertices_.reserve(nodes.size());
-  for (const auto& node_value : nodes)
-  {
-    const auto& node_object = node_value.get<picojson::object>();
-    this->vertices_.push_back(VertexProperties{
-      .x = node_object.at("x").get<double>(),
-      .y = node_object.at("y").get<double>(),
-    });
-  }
+  reader.for_each_node([this](const VertexProperties& vertex) { this->vertices_.push_back(vertex); });
 
   std::vector<std::vector<Edge>> collated_adjacencies;
   collated_adjacencies.resize(this->vertices_.size());
 
-  const auto& edges = root.at("edges").get<picojson::array>();
-  for (const auto& edge_value : edges)
-  {
-    const auto& edge_object = edge_value.get<picojson::object>();
-    const vertex_id_t src_vertex_id = edge_object.at("u").get<double>();
-    const vertex_id_t dst_vertex_id = edge_object.at("v").get<double>();
-    const edge_weight_t weight = std::max<edge_weight_t>(1, edge_object.at("w").get<double>());
-    collated_adjacencies[src_vertex_id].emplace_back(dst_vertex_id, weight);
-  }
+  const std::size_t edge_count = reader.for_each_edge(
+    [&collated_adjacencies](const EdgeRecord& edge)
+    {
+      collated_adjacencies[edge.u].emplace_back(edge.v, edge.weight);
+    });
 
-  this->edges_.reserve(edges.size());
-  this->adjacencies_.reserve(nodes.size());
+  this->edges_.reserve(edge_count);
+  this->adjacencies_.reserve(this->vertices_.size());
   std::size_t idx = 0;
   for (const auto& e : collated_adjacencies)
   {
@@ -54,50 +41,43 @@ Graph::Graph(const std::filesystem::path& graph_file_name)
 
 void Graph::shuffle(const std::vector<std::size_t>& indices)
 {
-  {
-    auto new_vertices = this->vertices_;
-    for (std::size_t i = 0; i < new_vertices.size(); ++i)
-    {
-      new_vertices[indices[i]] = this->vertices_[i];
-    }
-    new_vertices.swap(this->vertices_);
-  }
+  const std::size_t thread_count = default_thread_count();
 
-  {
-    std::vector<std::vector<Edge>> collated_adjacencies;
-    collated_adjacencies.resize(this->vertices_.size());
-    for (vertex_id_t pred = 0; pred < this->adjacencies_.size(); ++pred)
-    {
-      const auto& edges = this->adjacencies_[pred];
-      collated_adjacencies[pred] = std::vector<Edge>{edges.begin(), edges.end()};
-    }
+  this->vertices_ = permute_vertices(this->vertices_, indices, thread_count);
 
-    std::vector<std::vector<Edge>> shuffled_adjacencies;
-    shuffled_adjacencies.resize(this->vertices_.size());
-    for (vertex_id_t pred = 0; pred < this->adjacencies_.size(); ++pred)
+  const auto offsets = permute_offsets(
+    indices,
+    [this](vertex_id_t pred) { return this->adjacencies_[pred].size(); },
+    thread_count);
+
+  auto new_edges = permute_edges(
+    indices,
+    offsets,
+    [this, &indices](vertex_id_t pred, auto out)
     {
-      auto& shuffled = shuffled_adjacencies[indices[pred]];
-      shuffled.swap(collated_adjacencies[pred]);
-      for (auto& [succ, _] : shuffled)
-      {
-        succ = indices[succ];
-      }
-    }
+      std::transform(
+        this->adjacencies_[pred].begin(),
+        this->adjacencies_[pred].end(),
+        out,
+        [&indices](const Edge& edge) -> Edge
+        {
+          return {static_cast<vertex_id_t>(indices[edge.first]), edge.second};
+        });
+    },
+    Edge{0, EdgeProperties{0}},
+    thread_count);
+  this->edges_.swap(new_edges);
 
-    this->edges_.clear();
-    this->adjacencies_.clear();
-    std::size_t idx = 0;
-    for (const auto& e : shuffled_adjacencies)
+  parallel_for_ranges(
+    this->vertex_count(),
+    thread_count,
+    [this, &offsets](std::size_t first, std::size_t last, [[maybe_unused]] std::size_t range_index)
     {
-      std::size_t idx_start = idx;
-      for (const auto& edge : e)
+      for (std::size_t q = first; q < last; ++q)
       {
-        this->edges_.emplace_back(edge);
-        ++idx;
+        this->adjacencies_[q] = {this->edges_.data() + offsets[q], this->edges_.data() + offsets[q + 1]};
       }
-      this->adjacencies_.emplace_back(this->edges_.data() + idx_start, this->edges_.data() + idx);
-    }
-  }
+    });
 }
 
 }  // namespace cppcon::demo::a3
\ No newline at end of file
@@ -9,7 +9,7 @@ namespace cppcon::demo::a3
 
 void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings)
 {
-  ::cppcon::demo::run<TerminateAtGoal, Graph>(graph_in_json, result_out_json, settings, []([[maybe_unused]] auto& ctx) {});
+  ::cppcon::demo::run<TerminateAtGoal, Graph>(graph_in_json, result_out_json, settings);
 }
 
 }  // namespace cppcon::demo::a3
@@ -0,0 +1,124 @@
+#pragma once
+
+// C++ Standard Library
+#include <cmath>
+#include <limits>
+
+// CppCon
+#include <cppcon/epoch_array.h>
+#include <cppcon/search.h>
+#include <cppcon/demo/a3/context.h>
+
+namespace cppcon::demo::a4
+{
+
+/**
+ * Straight-line distance to the goal, as used by a3::TerminateAtGoal
+ */
+template<SearchGraph G>
+class EuclideanHeuristic
+{
+public:
+  void reset(const G& graph, vertex_id_t goal)
+  {
+    graph_ = &graph;
+    goal_ = graph.vertex(goal);
+  }
+
+  edge_weight_t operator()(vertex_id_t q) const
+  {
+    const auto& vq = graph_->vertex(q);
+    const double dx = (goal_.x - vq.x);
+    const double dy = (goal_.y - vq.y);
+    return std::sqrt(dx * dx + dy * dy);
+  }
+
+private:
+  const G* graph_ = nullptr;
+  VertexProperties goal_;
+};
+
+/**
+ * a3::TerminateAtGoal with O(1) reset
+ *
+ * Predecessors are kept in an EpochArray, and the heuristic is evaluated only for vertices which are
+ * actually queued (memoized per search) rather than for all vertices on every reset.
+ *
+ * \tparam HeuristicT  policy such that, after reset(graph, goal), heuristic(q) is a lower bound on the distance from q to the goal
+ */
+template<SearchGraph G, typename HeuristicT = EuclideanHeuristic<G>>
+class BasicTerminateAtGoal
+{
+public:
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  void reset(const G& graph, vertex_id_t s)
+  {
+    heuristic_policy_.reset(graph, goal_);
+
+    queue_back_buffer_.clear();
+    queue_.underlying().swap(queue_back_buffer_);
+
+    visited_.reset(graph.vertex_count(), kUnvisited);
+    heuristic_.reset(graph.vertex_count(), kUnknownHeuristic);
+
+    enqueue(s, s, 0);
+  }
+
+  bool is_queue_not_empty() const { return !queue_.empty(); }
+
+  bool is_visited(vertex_id_t q) const { return visited_.is_set(q); }
+
+  bool is_terminal(vertex_id_t q) const { return goal_ == q; }
+
+  void mark_visited(vertex_id_t p, vertex_id_t s) { visited_.set(s, p); }
+
+  vertex_id_t predecessor(vertex_id_t q) const
+  {
+    return visited_.get(q);
+  }
+
+  Transition dequeue()
+  {
+    auto t = queue_.top();
+    queue_.pop();
+    return t;
+  }
+
+  void enqueue(vertex_id_t p, vertex_id_t s, edge_weight_t w)
+  {
+    queue_.push(Transition{
+      .pred = p,
+      .succ = s,
+      .weight = w + heuristic(s)
+    });
+  }
+
+protected:
+  edge_weight_t heuristic(vertex_id_t q)
+  {
+    auto& h = heuristic_.touch(q);
+    if (h == kUnknownHeuristic)
+    {
+      h = heuristic_policy_(q);
+    }
+    return h;
+  }
+
+private:
+  static constexpr vertex_id_t kUnvisited = std::numeric_limits<vertex_id_t>::max();
+
+  static constexpr edge_weight_t kUnknownHeuristic = std::numeric_limits<edge_weight_t>::max();
+
+  HeuristicT heuristic_policy_;
+
+  vertex_id_t goal_;
+
+  a3::MinQueue<Transition> queue_;
+  std::vector<Transition> queue_back_buffer_;
+
+  EpochArray<vertex_id_t> visited_;
+  EpochArray<edge_weight_t> heuristic_;
+};
+
+}  // namespace cppcon::demo::a4
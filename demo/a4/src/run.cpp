@@ -0,0 +1,15 @@
+// CppCon
+#include <cppcon/demo/run_impl.ipp>
+#include <cppcon/demo/a3/graph.h>
+#include <cppcon/demo/a4/run.h>
+#include <cppcon/demo/a4/context.h>
+
+namespace cppcon::demo::a4
+{
+
+void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings)
+{
+  ::cppcon::demo::run<BasicTerminateAtGoal<a3::Graph>, a3::Graph>(graph_in_json, result_out_json, settings);
+}
+
+}  // namespace cppcon::demo::a4
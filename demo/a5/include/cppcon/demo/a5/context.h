@@ -0,0 +1,59 @@
+#pragma once
+
+// C++ Standard Library
+#include <cmath>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/v6/context.h>
+
+namespace cppcon::demo::a5
+{
+
+/**
+ * Average of the straight-line distances to the goal and from the start
+ *
+ * Using (h_goal(q) - h_start(q)) / 2 for the forward search and its negation for the backward search keeps
+ * both directions consistent with each other, which the meet-in-the-middle stopping criterion requires; the
+ * a3 heuristic alone would not. Valid when edge weights are no shorter than the straight line between
+ * their endpoints.
+ */
+template<SearchGraph G>
+class EuclideanPotential
+{
+public:
+  using key_type = double;
+
+  void reset(const G& graph, vertex_id_t s, vertex_id_t g)
+  {
+    graph_ = &graph;
+    start_ = graph.vertex(s);
+    goal_ = graph.vertex(g);
+  }
+
+  key_type operator()(vertex_id_t q) const
+  {
+    const auto& vq = graph_->vertex(q);
+    return 0.5 * (distance(goal_, vq) - distance(start_, vq));
+  }
+
+private:
+  static double distance(const VertexProperties& lhs, const VertexProperties& rhs)
+  {
+    const double dx = (lhs.x - rhs.x);
+    const double dy = (lhs.y - rhs.y);
+    return std::sqrt(dx * dx + dy * dy);
+  }
+
+  const G* graph_ = nullptr;
+  VertexProperties start_;
+  VertexProperties goal_;
+};
+
+/**
+ * Bidirectional A*
+ */
+template<SearchGraph G>
+using BasicTerminateAtGoal = v6::BasicTerminateAtGoal<G, EuclideanPotential<G>>;
+
+}  // namespace cppcon::demo::a5
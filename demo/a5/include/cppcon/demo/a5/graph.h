@@ -0,0 +1,12 @@
+#pragma once
+
+// CppCon
+#include <cppcon/demo/a3/graph.h>
+#include <cppcon/demo/v6/graph.h>
+
+namespace cppcon::demo::a5
+{
+
+using Graph = v6::BasicGraph<a3::Graph>;
+
+}  // namespace cppcon::demo::a5
@@ -0,0 +1,15 @@
+// CppCon
+#include <cppcon/demo/run_impl.ipp>
+#include <cppcon/demo/a5/run.h>
+#include <cppcon/demo/a5/context.h>
+#include <cppcon/demo/a5/graph.h>
+
+namespace cppcon::demo::a5
+{
+
+void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings)
+{
+  ::cppcon::demo::run<BasicTerminateAtGoal<Graph>, Graph>(graph_in_json, result_out_json, settings);
+}
+
+}  // namespace cppcon::demo::a5
@@ -0,0 +1,33 @@
+#pragma once
+
+// CppCon
+#include <cppcon/landmarks.h>
+#include <cppcon/search.h>
+#include <cppcon/demo/a4/context.h>
+
+namespace cppcon::demo::a6
+{
+
+/**
+ * A* with landmark (ALT) lower bounds in place of straight-line distance
+ *
+ * a3 and a4 add the heuristic of each vertex on top of the key of its parent, so heuristics accumulate
+ * along a path. Here the parent's heuristic is taken back out, which keeps keys at distance + heuristic;
+ * with consistent landmark bounds, vertices are then settled at their shortest distance and the search
+ * stays focused on the few vertices whose bound admits a shorter path.
+ *
+ * \tparam HeuristicT  as for a4::BasicTerminateAtGoal; any consistent heuristic gets the same key correction
+ */
+template<SearchGraph G, typename HeuristicT = LandmarkHeuristic<G>>
+class BasicTerminateAtGoal : public a4::BasicTerminateAtGoal<G, HeuristicT>
+{
+public:
+  using Base = a4::BasicTerminateAtGoal<G, HeuristicT>;
+
+  void enqueue(vertex_id_t p, vertex_id_t s, edge_weight_t w)
+  {
+    Base::enqueue(p, s, w - Base::heuristic(p));
+  }
+};
+
+}  // namespace cppcon::demo::a6
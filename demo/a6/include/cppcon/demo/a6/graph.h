@@ -0,0 +1,45 @@
+#pragma once
+
+// C++ Standard Library
+#include <filesystem>
+#include <vector>
+
+// CppCon
+#include <cppcon/landmarks.h>
+#include <cppcon/search.h>
+#include <cppcon/demo/a3/graph.h>
+
+namespace cppcon::demo::a6
+{
+
+/**
+ * a3::Graph with a landmark distance table, which is computed once when the graph is loaded
+ */
+class Graph
+{
+public:
+  explicit Graph(
+    const std::filesystem::path& json,
+    std::size_t landmark_count = 16,
+    LandmarkSelection selection = LandmarkSelection::kFarthest);
+
+  void shuffle(const std::vector<std::size_t>& indices);
+
+  const VertexProperties& vertex(vertex_id_t q) const { return graph_.vertex(q); }
+
+  std::size_t vertex_count() const { return graph_.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph_.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  const LandmarkTable& landmarks() const { return landmarks_; }
+
+private:
+  a3::Graph graph_;
+  LandmarkTable landmarks_;
+};
+
+}  // namespace cppcon::demo::a6
@@ -0,0 +1,21 @@
+// C++ Standard Library
+#include <thread>
+
+// CppCon
+#include <cppcon/demo/a6/graph.h>
+
+namespace cppcon::demo::a6
+{
+
+Graph::Graph(const std::filesystem::path& json, std::size_t landmark_count, LandmarkSelection selection) :
+  graph_{json},
+  landmarks_{graph_, landmark_count, selection, std::thread::hardware_concurrency()}
+{}
+
+void Graph::shuffle(const std::vector<std::size_t>& indices)
+{
+  graph_.shuffle(indices);
+  landmarks_.shuffle(indices);
+}
+
+}  // namespace cppcon::demo::a6
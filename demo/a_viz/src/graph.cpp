@@ -3,42 +3,28 @@
 
 // CppCon
 #include <cppcon/demo/a_viz/graph.h>
-#include <cppcon/demo/json.h>
+#include <cppcon/demo/graph_json.h>
 
 namespace cppcon::demo::a_viz
 {
 
 Graph::Graph(const std::filesystem::path& graph_file_name) : graph_file_name{graph_file_name}
 {
-  const auto v = load_json(graph_file_name);
-  const auto& root = v.get<picojson::object>();
-  const auto& nodes = root.at("nodes").get<picojson::array>();
+  const GraphJsonReader reader{graph_file_name};
 
-  this->vertices_.reserve(nodes.size());
-  for (const auto& node_value : nodes)
-  {
-    const auto& node_object = node_value.get<picojson::object>();
-    this->vertices_.push_back(VertexProperties{
-      .x = node_object.at("x").get<double>(),
-      .y = node_object.at("y").get<double>(),
-    });
-  }
+  reader.for_each_node([this](const VertexProperties& vertex) { this->vertices_.push_back(vertex); });
 
   std::vector<std::vector<Edge>> collated_adjacencies;
   collated_adjacencies.resize(this->vertices_.size());
 
-  const auto& edges = root.at("edges").get<picojson::array>();
-  for (const auto& edge_value : edges)
-  {
-    const auto& edge_object = edge_value.get<picojson::object>();
-    const vertex_id_t src_vertex_id = edge_object.at("u").get<double>();
-    const vertex_id_t dst_vertex_id = edge_object.at("v").get<double>();
-    const edge_weight_t weight = std::max<edge_weight_t>(1, edge_object.at("w").get<double>());
-    collated_adjacencies[src_vertex_id].emplace_back(dst_vertex_id, weight);
-  }
+  const std::size_t edge_count = reader.for_each_edge(
+    [&collated_adjacencies](const EdgeRecord& edge)
+    {
+      collated_adjacencies[edge.u].emplace_back(edge.v, edge.weight);
+    });
 
-  this->edges_.reserve(edges.size());
-  this->adjacencies_.reserve(nodes.size());
+  this->edges_.reserve(edge_count);
+  this->adjacencies_.reserve(this->vertices_.size());
   std::size_t idx = 0;
   for (const auto& e : collated_adjacencies)
   {
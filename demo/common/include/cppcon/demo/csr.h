@@ -0,0 +1,46 @@
+#pragma once
+
+// C++ Standard Library
+#include <filesystem>
+#include <span>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/graph_file.h>
+#include <cppcon/demo/parallel.h>
+
+namespace cppcon::demo
+{
+
+/**
+ * Flat compressed-sparse-row graph arrays, as stored in a binary graph file
+ */
+struct CSRData
+{
+  std::vector<VertexProperties> vertices;
+  std::vector<edge_offset_t> offsets;
+  std::vector<Edge> edges;
+};
+
+/**
+ * Loads a graph JSON file into CSR arrays; edges of each vertex keep their order of appearance in the file
+ */
+CSRData load_csr_from_json(const std::filesystem::path& path);
+
+/**
+ * Loads either a binary graph file or a graph JSON file into CSR arrays, with vertices in input order
+ */
+CSRData load_csr(const std::filesystem::path& path);
+
+/**
+ * Returns CSR arrays in which vertex q becomes vertex indices[q], keeping the order of edges within each adjacency
+ */
+CSRData permute_csr(
+  std::span<const VertexProperties> vertices,
+  std::span<const edge_offset_t> offsets,
+  std::span<const Edge> edges,
+  const std::vector<std::size_t>& indices,
+  std::size_t thread_count = default_thread_count());
+
+}  // namespace cppcon::demo
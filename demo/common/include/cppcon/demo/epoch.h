@@ -0,0 +1,210 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cppcon::demo
+{
+
+/**
+ * Epoch-based reclamation of objects which lock-free readers may still be using
+ *
+ * Every reader owns a slot in which it announces the global epoch for as long as it is inside a critical
+ * section. A writer unlinks an object, then retires it, which tags it with the current epoch and advances
+ * the epoch; the object is destroyed once every reader inside a critical section has announced a later
+ * epoch. Readers only ever store to their own slot, so entering and leaving a critical section never waits.
+ *
+ * Retiring and collecting must be serialized by the caller; registering readers and entering critical
+ * sections may happen on any thread.
+ */
+class EpochDomain
+{
+  struct alignas(64) Slot
+  {
+    std::atomic<std::uint64_t> epoch{kIdle};
+    std::atomic<bool> in_use{false};
+  };
+
+public:
+  /**
+   * Critical section of a reader; objects reachable when it was entered stay alive until it is left
+   */
+  class Guard
+  {
+  public:
+    Guard() = default;
+
+    Guard(Guard&& other) : slot_{std::exchange(other.slot_, nullptr)} {}
+
+    Guard& operator=(Guard&& other)
+    {
+      Guard{std::move(*this)};
+      slot_ = std::exchange(other.slot_, nullptr);
+      return *this;
+    }
+
+    ~Guard()
+    {
+      if (slot_ != nullptr)
+      {
+        slot_->epoch.store(kIdle, std::memory_order_release);
+      }
+    }
+
+  private:
+    friend class EpochDomain;
+
+    explicit Guard(Slot* slot) : slot_{slot} {}
+
+    Slot* slot_ = nullptr;
+  };
+
+  /**
+   * Slot of one reader thread, which may be in at most one critical section at a time
+   */
+  class Reader
+  {
+  public:
+    Reader() = default;
+
+    Reader(Reader&& other) :
+      domain_{std::exchange(other.domain_, nullptr)},
+      slot_{std::exchange(other.slot_, nullptr)}
+    {}
+
+    Reader& operator=(Reader&& other)
+    {
+      Reader{std::move(*this)};
+      domain_ = std::exchange(other.domain_, nullptr);
+      slot_ = std::exchange(other.slot_, nullptr);
+      return *this;
+    }
+
+    ~Reader()
+    {
+      if (slot_ != nullptr)
+      {
+        slot_->in_use.store(false, std::memory_order_release);
+      }
+    }
+
+    /**
+     * Enters a critical section; shared pointers must be loaded only after this returns
+     */
+    Guard enter() const
+    {
+      // Sequentially consistent, so that this announcement is ordered before every pointer loaded after it
+      slot_->epoch.store(domain_->epoch_.load(std::memory_order_acquire));
+      return Guard{slot_};
+    }
+
+  private:
+    friend class EpochDomain;
+
+    Reader(const EpochDomain* domain, Slot* slot) : domain_{domain}, slot_{slot} {}
+
+    const EpochDomain* domain_ = nullptr;
+    Slot* slot_ = nullptr;
+  };
+
+  explicit EpochDomain(std::size_t max_reader_count) :
+    slot_count_{max_reader_count},
+    slots_{std::make_unique<Slot[]>(max_reader_count)}
+  {}
+
+  EpochDomain(const EpochDomain&) = delete;
+
+  EpochDomain& operator=(const EpochDomain&) = delete;
+
+  ~EpochDomain()
+  {
+    for (auto& retired : retired_)
+    {
+      retired.deleter();
+    }
+  }
+
+  /**
+   * Claims a free reader slot
+   *
+   * \throw std::runtime_error  if all max_reader_count slots are in use
+   */
+  Reader register_reader()
+  {
+    for (std::size_t i = 0; i < slot_count_; ++i)
+    {
+      if (bool expected = false; slots_[i].in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+      {
+        return Reader{this, &slots_[i]};
+      }
+    }
+    throw std::runtime_error{"all epoch reader slots are in use"};
+  }
+
+  /**
+   * Schedules \c deleter to run once no reader can still be using the object it destroys, which must
+   * already have been unlinked from everything readers load
+   */
+  void retire(std::function<void()> deleter)
+  {
+    retired_.push_back(Retired{.epoch = epoch_.fetch_add(1), .deleter = std::move(deleter)});
+  }
+
+  /**
+   * Runs the deleters of retired objects which no reader can still be using
+   *
+   * \return the number of objects destroyed
+   */
+  std::size_t collect()
+  {
+    std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+    for (std::size_t i = 0; i < slot_count_; ++i)
+    {
+      if (const std::uint64_t epoch = slots_[i].epoch.load(); epoch != kIdle)
+      {
+        oldest = std::min(oldest, epoch);
+      }
+    }
+
+    // Objects retired before the oldest announced epoch were unlinked before any current reader entered
+    const auto first_kept = std::stable_partition(
+      retired_.begin(),
+      retired_.end(),
+      [oldest](const Retired& retired) { return retired.epoch < oldest; });
+    std::for_each(retired_.begin(), first_kept, [](Retired& retired) { retired.deleter(); });
+    const std::size_t collected = first_kept - retired_.begin();
+    retired_.erase(retired_.begin(), first_kept);
+    return collected;
+  }
+
+  /**
+   * Returns the number of retired objects which are not yet destroyed
+   */
+  std::size_t retired_count() const { return retired_.size(); }
+
+private:
+  static constexpr std::uint64_t kIdle = 0;
+
+  struct Retired
+  {
+    std::uint64_t epoch;
+    std::function<void()> deleter;
+  };
+
+  std::atomic<std::uint64_t> epoch_{1};
+
+  std::size_t slot_count_;
+  std::unique_ptr<Slot[]> slots_;
+
+  std::vector<Retired> retired_;
+};
+
+}  // namespace cppcon::demo
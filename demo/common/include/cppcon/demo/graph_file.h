@@ -0,0 +1,144 @@
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <type_traits>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/reorder.h>
+
+namespace cppcon::demo
+{
+
+/**
+ * Binary CSR graph file layout (host byte order, every section aligned to kGraphFileAlignment):
+ *
+ *   GraphFileHeader
+ *   VertexProperties[vertex_count]     <-- 'vertices' section
+ *   std::uint32_t[vertex_count + 1]    <-- 'offsets' section; edges of q are [offsets[q], offsets[q + 1])
+ *   Edge[edge_count]                   <-- 'edges' section
+ *   vertex_id_t[vertex_count]          <-- 'input_ids' section; input ID of each vertex, or empty if stored in input order
+ *
+ * Records are stored exactly as they are laid out in memory so that a mapped file can be used in-place.
+ * Vertices may be stored re-ordered (see convert_graph), in which case the header names the ordering and
+ * 'input_ids' maps them back to the vertex IDs of the graph they were converted from.
+ */
+constexpr std::uint32_t kGraphFileVersion = 2;
+
+constexpr std::size_t kGraphFileAlignment = 64;
+
+constexpr char kGraphFileMagic[8] = {'C', 'P', 'P', 'C', 'O', 'N', 'G', '\0'};
+
+using edge_offset_t = std::uint32_t;
+
+static_assert(std::is_trivially_copyable_v<VertexProperties>);
+static_assert(std::is_trivially_copyable_v<EdgeProperties>);
+static_assert(sizeof(Edge) == sizeof(vertex_id_t) + sizeof(EdgeProperties));
+
+struct GraphFileSection
+{
+  std::uint64_t offset;
+  std::uint64_t size;
+};
+
+struct GraphFileHeader
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order_tag;
+  std::uint32_t vertex_record_size;
+  std::uint32_t edge_record_size;
+  std::uint64_t vertex_count;
+  std::uint64_t edge_count;
+  GraphFileSection vertices;
+  GraphFileSection offsets;
+  GraphFileSection edges;
+  std::uint64_t ordering;
+  GraphFileSection input_ids;
+};
+
+/**
+ * Read-only memory mapping of an entire file
+ */
+class MappedFile
+{
+public:
+  MappedFile() = default;
+
+  explicit MappedFile(const std::filesystem::path& path);
+
+  MappedFile(MappedFile&& other);
+
+  MappedFile& operator=(MappedFile&& other);
+
+  MappedFile(const MappedFile&) = delete;
+
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile();
+
+  const std::byte* data() const { return data_; }
+
+  std::size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+private:
+  std::byte* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+/**
+ * Validated view over the sections of a binary graph file
+ */
+class GraphFileView
+{
+public:
+  explicit GraphFileView(const MappedFile& file);
+
+  std::span<const VertexProperties> vertices() const { return vertices_; }
+
+  std::span<const edge_offset_t> offsets() const { return offsets_; }
+
+  std::span<const Edge> edges() const { return edges_; }
+
+  /**
+   * Returns the ordering in which vertices are stored; Ordering::kIdentity if they are in input order
+   */
+  Ordering ordering() const { return ordering_; }
+
+  /**
+   * Returns the input ID of every stored vertex, or nothing if vertices are stored in input order
+   */
+  std::span<const vertex_id_t> input_ids() const { return input_ids_; }
+
+private:
+  std::span<const VertexProperties> vertices_;
+  std::span<const edge_offset_t> offsets_;
+  std::span<const Edge> edges_;
+  Ordering ordering_ = Ordering::kIdentity;
+  std::span<const vertex_id_t> input_ids_;
+};
+
+/**
+ * Returns true if the file at \c path starts with a binary graph file header
+ */
+bool is_graph_file(const std::filesystem::path& path);
+
+/**
+ * Writes a binary graph file; vertices stored in an \c ordering other than Ordering::kIdentity take the
+ * input ID of each stored vertex in \c input_ids
+ */
+void write_graph_file(
+  const std::filesystem::path& path,
+  std::span<const VertexProperties> vertices,
+  std::span<const edge_offset_t> offsets,
+  std::span<const Edge> edges,
+  Ordering ordering = Ordering::kIdentity,
+  std::span<const vertex_id_t> input_ids = {});
+
+}  // namespace cppcon::demo
@@ -0,0 +1,93 @@
+#pragma once
+
+// C++ Standard Library
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/graph_file.h>
+#include <cppcon/demo/parallel.h>
+
+namespace cppcon::demo
+{
+
+struct EdgeRecord
+{
+  vertex_id_t u;
+  vertex_id_t v;
+  edge_weight_t weight;
+};
+
+/**
+ * Streaming reader for graph JSON files, as produced by py/extract.py
+ *
+ * The file is mapped and scanned in place; no JSON document tree is built. Numbers are parsed with
+ * std::from_chars, and vertex IDs and weights are read as integers directly (weights are truncated and
+ * clamped to at least 1, as before). Nodes are parsed as they are visited. The edge array is parsed a
+ * window at a time; each window is split into chunks at record boundaries which are parsed in parallel into
+ * flat buffers, then visited in file order, so at most one window of edges is buffered for any file size.
+ * A node without "x" and "y", or an edge without "u", "v" and "w", throws std::runtime_error.
+ */
+class GraphJsonReader
+{
+public:
+  explicit GraphJsonReader(const std::filesystem::path& path);
+
+  template<typename NodeVisitorT>
+  std::size_t for_each_node(NodeVisitorT&& visitor) const
+  {
+    std::string_view text = nodes_;
+    VertexProperties vertex;
+    std::size_t count = 0;
+    while (next_node(text, vertex))
+    {
+      visitor(vertex);
+      ++count;
+    }
+    return count;
+  }
+
+  template<typename EdgeVisitorT>
+  std::size_t for_each_edge(EdgeVisitorT&& visitor, std::size_t thread_count = default_thread_count()) const
+  {
+    std::string_view text = edges_;
+    std::vector<std::vector<EdgeRecord>> chunks;
+    std::size_t count = 0;
+    while (parse_edge_window(text, chunks, thread_count))
+    {
+      for (const auto& chunk : chunks)
+      {
+        for (const auto& edge : chunk)
+        {
+          visitor(edge);
+        }
+        count += chunk.size();
+      }
+    }
+    return count;
+  }
+
+private:
+  /**
+   * Parses the next node record into \c vertex, which is reset first; returns false after the last node
+   */
+  static bool next_node(std::string_view& text, VertexProperties& vertex);
+
+  /**
+   * Parses the next window of edge records in \c text into \c chunks, in file order, and moves \c text past
+   * it; returns false once \c text is exhausted
+   *
+   * Chunk buffers are re-used from one window to the next.
+   *
+   * \throw std::runtime_error  if any record is malformed or incomplete
+   */
+  static bool parse_edge_window(std::string_view& text, std::vector<std::vector<EdgeRecord>>& chunks, std::size_t thread_count);
+
+  MappedFile file_;
+  std::string_view nodes_;
+  std::string_view edges_;
+};
+
+}  // namespace cppcon::demo
@@ -0,0 +1,172 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cppcon::demo
+{
+
+inline std::size_t default_thread_count()
+{
+  return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * Splits [0, n) into at most \c thread_count contiguous ranges and invokes fn(first, last, range_index)
+ * for each on its own thread; the calling thread handles the first range
+ *
+ * The first exception thrown by any range is re-thrown once all ranges have finished.
+ */
+template<typename RangeFnT>
+void parallel_for_ranges(std::size_t n, std::size_t thread_count, RangeFnT&& fn)
+{
+  const std::size_t range_count = std::max<std::size_t>(1, std::min(n, thread_count));
+  const std::size_t range_size = (n + range_count - 1) / range_count;
+
+  std::vector<std::exception_ptr> errors(range_count);
+  const auto run_range = [&fn, &errors, n, range_size](std::size_t r)
+  {
+    try
+    {
+      const std::size_t first = std::min(n, r * range_size);
+      fn(first, std::min(n, first + range_size), r);
+    }
+    catch (...)
+    {
+      errors[r] = std::current_exception();
+    }
+  };
+
+  {
+    std::vector<std::jthread> workers;
+    workers.reserve(range_count - 1);
+    for (std::size_t r = 1; r < range_count; ++r)
+    {
+      workers.emplace_back(run_range, r);
+    }
+    run_range(0);
+  }
+
+  for (const auto& error : errors)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+/**
+ * Invokes fn(i, worker_index) for every i in [0, n) on \c thread_count workers; the calling thread is worker 0
+ *
+ * Each worker starts on its own contiguous range of indices and takes them in order. A worker which runs
+ * out steals the upper half of the remaining range of another, so uneven tasks still keep every worker
+ * busy while neighbouring indices mostly stay on the same worker. Every worker invokes
+ * on_worker_start(worker_index) before its first task.
+ *
+ * The first exception thrown by any worker is re-thrown once all workers have finished.
+ */
+template<typename TaskFnT, typename WorkerStartFnT>
+void parallel_for_stealing(std::size_t n, std::size_t thread_count, TaskFnT&& fn, WorkerStartFnT&& on_worker_start)
+{
+  struct alignas(64) Range
+  {
+    std::mutex mutex;
+    std::size_t first;
+    std::size_t last;
+  };
+
+  const std::size_t worker_count = std::max<std::size_t>(1, std::min(n, thread_count));
+  const std::size_t range_size = (n + worker_count - 1) / worker_count;
+
+  const auto ranges = std::make_unique<Range[]>(worker_count);
+  for (std::size_t w = 0; w < worker_count; ++w)
+  {
+    ranges[w].first = std::min(n, w * range_size);
+    ranges[w].last = std::min(n, ranges[w].first + range_size);
+  }
+
+  // Moves the upper half of the range of some other worker into the (empty) range of worker w
+  const auto steal = [&ranges, worker_count](std::size_t w)
+  {
+    for (std::size_t offset = 1; offset < worker_count; ++offset)
+    {
+      auto& victim = ranges[(w + offset) % worker_count];
+      std::size_t first, last;
+      {
+        const std::lock_guard lock{victim.mutex};
+        if (victim.first == victim.last)
+        {
+          continue;
+        }
+        first = victim.first + (victim.last - victim.first) / 2;
+        last = std::exchange(victim.last, first);
+      }
+      const std::lock_guard lock{ranges[w].mutex};
+      ranges[w].first = first;
+      ranges[w].last = last;
+      return true;
+    }
+    return false;
+  };
+
+  std::vector<std::exception_ptr> errors(worker_count);
+  const auto run_worker = [&](std::size_t w)
+  {
+    try
+    {
+      on_worker_start(w);
+      while (true)
+      {
+        std::size_t i = n;
+        {
+          const std::lock_guard lock{ranges[w].mutex};
+          if (ranges[w].first < ranges[w].last)
+          {
+            i = ranges[w].first++;
+          }
+        }
+
+        if (i < n)
+        {
+          fn(i, w);
+        }
+        else if (!steal(w))
+        {
+          break;
+        }
+      }
+    }
+    catch (...)
+    {
+      errors[w] = std::current_exception();
+    }
+  };
+
+  {
+    std::vector<std::jthread> workers;
+    workers.reserve(worker_count - 1);
+    for (std::size_t w = 1; w < worker_count; ++w)
+    {
+      workers.emplace_back(run_worker, w);
+    }
+    run_worker(0);
+  }
+
+  for (const auto& error : errors)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace cppcon::demo
@@ -0,0 +1,114 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/graph_file.h>
+#include <cppcon/demo/parallel.h>
+
+namespace cppcon::demo
+{
+
+/**
+ * Returns per-vertex values moved to their permuted positions, i.e. permuted[indices[q]] = values[q]
+ */
+template<typename T>
+std::vector<T> permute_vertices(const std::vector<T>& values, const std::vector<std::size_t>& indices, std::size_t thread_count)
+{
+  std::vector<T> permuted(values.size());
+  parallel_for_ranges(
+    values.size(),
+    thread_count,
+    [&](std::size_t first, std::size_t last, [[maybe_unused]] std::size_t range_index)
+    {
+      for (std::size_t q = first; q < last; ++q)
+      {
+        permuted[indices[q]] = values[q];
+      }
+    });
+  return permuted;
+}
+
+/**
+ * Returns the (vertex_count + 1) CSR offsets of a graph once its vertices are permuted
+ *
+ * Out-degrees are counted into their permuted positions, then turned into offsets with a parallel exclusive
+ * scan: each thread sums its range, range sums are scanned serially, and each thread then scans its range
+ * starting from the sum of all preceding ranges.
+ *
+ * \param degree  callable such that degree(q) is the out-degree of (original) vertex q
+ */
+template<typename DegreeFnT>
+std::vector<edge_offset_t> permute_offsets(const std::vector<std::size_t>& indices, DegreeFnT&& degree, std::size_t thread_count)
+{
+  const std::size_t n = indices.size();
+
+  std::vector<edge_offset_t> offsets(n + 1, 0);
+  parallel_for_ranges(
+    n,
+    thread_count,
+    [&](std::size_t first, std::size_t last, [[maybe_unused]] std::size_t range_index)
+    {
+      for (std::size_t q = first; q < last; ++q)
+      {
+        offsets[indices[q]] = degree(q);
+      }
+    });
+
+  // Ranges must match between both passes, which holds for the same (n, thread_count)
+  std::vector<edge_offset_t> range_sums(std::max<std::size_t>(1, std::min(n, thread_count)) + 1, 0);
+  parallel_for_ranges(
+    n,
+    thread_count,
+    [&](std::size_t first, std::size_t last, std::size_t range_index)
+    {
+      range_sums[range_index + 1] = std::accumulate(offsets.begin() + first, offsets.begin() + last, edge_offset_t{0});
+    });
+  std::partial_sum(range_sums.begin(), range_sums.end(), range_sums.begin());
+
+  parallel_for_ranges(
+    n,
+    thread_count,
+    [&](std::size_t first, std::size_t last, std::size_t range_index)
+    {
+      std::exclusive_scan(offsets.begin() + first, offsets.begin() + last, offsets.begin() + first, range_sums[range_index]);
+    });
+  offsets[n] = range_sums.back();
+
+  return offsets;
+}
+
+/**
+ * Scatters the edges of every vertex into their permuted CSR position
+ *
+ * \param copy_edges  callable such that copy_edges(q, out) copies the (relabeled) edges of original vertex q
+ *                    to the output iterator \c out
+ * \param blank  placeholder value for edge storage before it is overwritten
+ */
+template<typename EdgeT, typename CopyEdgesFnT>
+std::vector<EdgeT> permute_edges(
+  const std::vector<std::size_t>& indices,
+  const std::vector<edge_offset_t>& permuted_offsets,
+  CopyEdgesFnT&& copy_edges,
+  const EdgeT& blank,
+  std::size_t thread_count)
+{
+  std::vector<EdgeT> permuted(permuted_offsets.back(), blank);
+  parallel_for_ranges(
+    indices.size(),
+    thread_count,
+    [&](std::size_t first, std::size_t last, [[maybe_unused]] std::size_t range_index)
+    {
+      for (std::size_t q = first; q < last; ++q)
+      {
+        copy_edges(q, permuted.begin() + permuted_offsets[indices[q]]);
+      }
+    });
+  return permuted;
+}
+
+}  // namespace cppcon::demo
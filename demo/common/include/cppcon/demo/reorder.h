@@ -0,0 +1,392 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+
+namespace cppcon::demo
+{
+
+enum class Ordering
+{
+  kIdentity,
+  kRandom,
+  kHilbert,
+  kReverseCuthillMcKee,
+  kBreadthFirst,
+  kDepthFirst,
+};
+
+constexpr std::string_view to_string(Ordering ordering)
+{
+  switch (ordering)
+  {
+    case Ordering::kIdentity: return "identity";
+    case Ordering::kRandom: return "random";
+    case Ordering::kHilbert: return "hilbert";
+    case Ordering::kReverseCuthillMcKee: return "rcm";
+    case Ordering::kBreadthFirst: return "bfs";
+    case Ordering::kDepthFirst: return "dfs";
+  }
+  return "";
+}
+
+constexpr std::optional<Ordering> to_ordering(std::string_view name)
+{
+  for (const auto ordering : {Ordering::kIdentity,
+                              Ordering::kRandom,
+                              Ordering::kHilbert,
+                              Ordering::kReverseCuthillMcKee,
+                              Ordering::kBreadthFirst,
+                              Ordering::kDepthFirst})
+  {
+    if (to_string(ordering) == name)
+    {
+      return ordering;
+    }
+  }
+  return std::nullopt;
+}
+
+/**
+ * Bijection between external vertex IDs (as in the graph file) and internal vertex IDs (after re-ordering)
+ */
+class VertexPermutation
+{
+public:
+  VertexPermutation() = default;
+
+  /**
+   * Creates a permutation from vertices listed in their new (internal) order
+   */
+  static VertexPermutation from_sequence(const std::vector<vertex_id_t>& external_in_internal_order)
+  {
+    VertexPermutation permutation;
+    permutation.to_external_ = external_in_internal_order;
+    permutation.to_internal_.resize(external_in_internal_order.size());
+    for (std::size_t i = 0; i < external_in_internal_order.size(); ++i)
+    {
+      permutation.to_internal_[external_in_internal_order[i]] = i;
+    }
+    return permutation;
+  }
+
+  vertex_id_t internal(vertex_id_t external) const { return to_internal_[external]; }
+
+  vertex_id_t external(vertex_id_t internal) const { return to_external_[internal]; }
+
+  std::size_t size() const { return to_internal_.size(); }
+
+  /**
+   * Returns the permutation which applies this one, then \c next to the internal IDs of this one
+   */
+  VertexPermutation then(const VertexPermutation& next) const
+  {
+    std::vector<vertex_id_t> sequence(next.to_external_.size());
+    for (std::size_t i = 0; i < sequence.size(); ++i)
+    {
+      sequence[i] = to_external_[next.to_external_[i]];
+    }
+    return from_sequence(sequence);
+  }
+
+  /**
+   * Returns new indices of all external vertices, in the form expected by Graph::shuffle
+   */
+  const std::vector<std::size_t>& indices() const { return to_internal_; }
+
+private:
+  std::vector<std::size_t> to_internal_;
+  std::vector<vertex_id_t> to_external_;
+};
+
+/**
+ * Returns the distance along a Hilbert curve filling a (2^16 x 2^16) grid to the cell (x, y)
+ */
+constexpr std::uint64_t hilbert_index(std::uint32_t x, std::uint32_t y)
+{
+  constexpr std::uint32_t kSide = 1U << 16;
+  std::uint64_t d = 0;
+  for (std::uint32_t s = kSide / 2; s > 0; s /= 2)
+  {
+    const std::uint32_t rx = (x & s) > 0;
+    const std::uint32_t ry = (y & s) > 0;
+    d += std::uint64_t{s} * s * ((3 * rx) ^ ry);
+    if (ry == 0)
+    {
+      if (rx == 1)
+      {
+        x = kSide - 1 - x;
+        y = kSide - 1 - y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+template<SearchGraph G>
+std::vector<vertex_id_t> hilbert_sequence(const G& graph)
+{
+  const std::size_t n = graph.vertex_count();
+
+  double x_min = std::numeric_limits<double>::max(), x_max = std::numeric_limits<double>::lowest();
+  double y_min = std::numeric_limits<double>::max(), y_max = std::numeric_limits<double>::lowest();
+  for (vertex_id_t q = 0; q < n; ++q)
+  {
+    const auto& v = graph.vertex(q);
+    x_min = std::min(x_min, v.x);
+    x_max = std::max(x_max, v.x);
+    y_min = std::min(y_min, v.y);
+    y_max = std::max(y_max, v.y);
+  }
+
+  // Quantize onto the curve's grid, keeping the aspect ratio of the graph's bounding box
+  const double extent = std::max({x_max - x_min, y_max - y_min, std::numeric_limits<double>::min()});
+  const double scale = ((1U << 16) - 1) / extent;
+
+  std::vector<std::uint64_t> keys(n);
+  for (vertex_id_t q = 0; q < n; ++q)
+  {
+    const auto& v = graph.vertex(q);
+    keys[q] = hilbert_index(
+      static_cast<std::uint32_t>((v.x - x_min) * scale),
+      static_cast<std::uint32_t>((v.y - y_min) * scale));
+  }
+
+  std::vector<vertex_id_t> sequence(n);
+  std::iota(sequence.begin(), sequence.end(), 0);
+  std::stable_sort(
+    sequence.begin(),
+    sequence.end(),
+    [&keys](vertex_id_t lhs, vertex_id_t rhs) { return keys[lhs] < keys[rhs]; });
+  return sequence;
+}
+
+template<SearchGraph G>
+std::vector<std::size_t> out_degrees(const G& graph)
+{
+  std::vector<std::size_t> degrees(graph.vertex_count(), 0);
+  for (vertex_id_t q = 0; q < graph.vertex_count(); ++q)
+  {
+    graph.for_each_edge(q, [&degrees, q](vertex_id_t, const EdgeProperties&) { ++degrees[q]; });
+  }
+  return degrees;
+}
+
+/**
+ * Lists vertices in breadth-first order, restarting from the lowest-degree unvisited vertex for each
+ * connected component; when \c by_degree is set, the children of each vertex are visited in order of
+ * increasing degree (Cuthill-McKee)
+ */
+template<SearchGraph G>
+std::vector<vertex_id_t> breadth_first_sequence(const G& graph, bool by_degree)
+{
+  const std::size_t n = graph.vertex_count();
+  const auto degrees = out_degrees(graph);
+
+  std::vector<vertex_id_t> roots(n);
+  std::iota(roots.begin(), roots.end(), 0);
+  std::stable_sort(
+    roots.begin(),
+    roots.end(),
+    [&degrees](vertex_id_t lhs, vertex_id_t rhs) { return degrees[lhs] < degrees[rhs]; });
+
+  std::vector<bool> visited(n, false);
+  std::vector<vertex_id_t> sequence;
+  sequence.reserve(n);
+  for (const vertex_id_t root : roots)
+  {
+    if (visited[root])
+    {
+      continue;
+    }
+
+    visited[root] = true;
+    sequence.push_back(root);
+    for (std::size_t head = sequence.size() - 1; head < sequence.size(); ++head)
+    {
+      const std::size_t first_child = sequence.size();
+      graph.for_each_edge(
+        sequence[head],
+        [&visited, &sequence](vertex_id_t child, const EdgeProperties&)
+        {
+          if (!visited[child])
+          {
+            visited[child] = true;
+            sequence.push_back(child);
+          }
+        });
+
+      if (by_degree)
+      {
+        std::stable_sort(
+          sequence.begin() + first_child,
+          sequence.end(),
+          [&degrees](vertex_id_t lhs, vertex_id_t rhs) { return degrees[lhs] < degrees[rhs]; });
+      }
+    }
+  }
+  return sequence;
+}
+
+template<SearchGraph G>
+std::vector<vertex_id_t> reverse_cuthill_mckee_sequence(const G& graph)
+{
+  auto sequence = breadth_first_sequence(graph, true);
+  std::reverse(sequence.begin(), sequence.end());
+  return sequence;
+}
+
+/**
+ * Lists vertices in depth-first pre-order, restarting from vertex 0 onwards for each connected component
+ */
+template<SearchGraph G>
+std::vector<vertex_id_t> depth_first_sequence(const G& graph)
+{
+  const std::size_t n = graph.vertex_count();
+
+  std::vector<bool> visited(n, false);
+  std::vector<vertex_id_t> sequence;
+  sequence.reserve(n);
+
+  std::vector<vertex_id_t> stack;
+  std::vector<vertex_id_t> children;
+  for (vertex_id_t root = 0; root < n; ++root)
+  {
+    stack.push_back(root);
+    while (!stack.empty())
+    {
+      const vertex_id_t q = stack.back();
+      stack.pop_back();
+      if (visited[q])
+      {
+        continue;
+      }
+      visited[q] = true;
+      sequence.push_back(q);
+
+      // Push children in reverse so that they are expanded in adjacency order
+      children.clear();
+      graph.for_each_edge(
+        q,
+        [&visited, &children](vertex_id_t child, const EdgeProperties&)
+        {
+          if (!visited[child])
+          {
+            children.push_back(child);
+          }
+        });
+      stack.insert(stack.end(), children.rbegin(), children.rend());
+    }
+  }
+  return sequence;
+}
+
+template<SearchGraph G>
+VertexPermutation make_permutation(const G& graph, Ordering ordering, std::size_t seed = 0)
+{
+  switch (ordering)
+  {
+    case Ordering::kRandom:
+    {
+      std::vector<vertex_id_t> sequence(graph.vertex_count());
+      std::iota(sequence.begin(), sequence.end(), 0);
+      std::shuffle(sequence.begin(), sequence.end(), std::mt19937{static_cast<std::mt19937::result_type>(seed)});
+      return VertexPermutation::from_sequence(sequence);
+    }
+    case Ordering::kHilbert:
+      return VertexPermutation::from_sequence(hilbert_sequence(graph));
+    case Ordering::kReverseCuthillMcKee:
+      return VertexPermutation::from_sequence(reverse_cuthill_mckee_sequence(graph));
+    case Ordering::kBreadthFirst:
+      return VertexPermutation::from_sequence(breadth_first_sequence(graph, false));
+    case Ordering::kDepthFirst:
+      return VertexPermutation::from_sequence(depth_first_sequence(graph));
+    case Ordering::kIdentity:
+      break;
+  }
+
+  std::vector<vertex_id_t> sequence(graph.vertex_count());
+  std::iota(sequence.begin(), sequence.end(), 0);
+  return VertexPermutation::from_sequence(sequence);
+}
+
+/**
+ * Returns the ordering in which \c graph was stored, and the permutation from its input vertex IDs to its
+ * vertex IDs; graphs which do not record one are taken to be stored in input order
+ */
+template<SearchGraph G>
+std::pair<Ordering, VertexPermutation> stored_permutation(const G& graph)
+{
+  if constexpr (requires { { graph.stored_ordering() } -> std::convertible_to<Ordering>; graph.input_ids(); })
+  {
+    if (graph.stored_ordering() != Ordering::kIdentity)
+    {
+      return {graph.stored_ordering(), VertexPermutation::from_sequence({graph.input_ids().begin(), graph.input_ids().end()})};
+    }
+  }
+  return {Ordering::kIdentity, make_permutation(graph, Ordering::kIdentity)};
+}
+
+/**
+ * Locality of edges under a vertex ordering
+ *
+ * The span of an edge is the distance between the internal IDs of its endpoints, i.e. how far apart their
+ * entries are in per-vertex arrays such as a context's visited/predecessor array.
+ */
+struct LocalityMetrics
+{
+  /// Mean edge span
+  double average_edge_span = 0;
+  /// Largest edge span (matrix bandwidth)
+  std::size_t bandwidth = 0;
+  /// Fraction of edges whose endpoints' 4-byte per-vertex entries share a 64-byte cache line
+  double same_cache_line_fraction = 0;
+};
+
+template<SearchGraph G>
+LocalityMetrics compute_locality(const G& graph, const VertexPermutation& permutation)
+{
+  static constexpr std::size_t kEntriesPerCacheLine = 64 / sizeof(vertex_id_t);
+
+  LocalityMetrics metrics;
+  std::size_t edge_count = 0;
+  std::size_t same_line_count = 0;
+  double total_span = 0;
+  for (vertex_id_t u = 0; u < graph.vertex_count(); ++u)
+  {
+    const std::size_t u_internal = permutation.internal(u);
+    graph.for_each_edge(
+      u,
+      [&](vertex_id_t v, const EdgeProperties&)
+      {
+        const std::size_t v_internal = permutation.internal(v);
+        const std::size_t span = (u_internal > v_internal) ? (u_internal - v_internal) : (v_internal - u_internal);
+        total_span += span;
+        metrics.bandwidth = std::max(metrics.bandwidth, span);
+        same_line_count += (u_internal / kEntriesPerCacheLine) == (v_internal / kEntriesPerCacheLine);
+        ++edge_count;
+      });
+  }
+
+  if (edge_count > 0)
+  {
+    metrics.average_edge_span = total_span / edge_count;
+    metrics.same_cache_line_fraction = static_cast<double>(same_line_count) / edge_count;
+  }
+  return metrics;
+}
+
+}  // namespace cppcon::demo
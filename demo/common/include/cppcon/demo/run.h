@@ -2,10 +2,13 @@
 
 // C++ Standard Library
 #include <filesystem>
+#include <stdexcept>
 #include <vector>
 
 // CppCon
+#include <cppcon/bidirectional_search.h>
 #include <cppcon/search.h>
+#include <cppcon/demo/reorder.h>
 
 namespace cppcon::demo
 {
@@ -20,10 +23,49 @@ struct Settings
 
   std::size_t shuffle_seed = 0;
 
+  /// Vertex ordering applied before searching; a non-zero shuffle_seed selects a random ordering instead
+  Ordering ordering = Ordering::kHilbert;
+
   bool run_search = true;
+
+  /// Answer all starts for each goal from one reverse search (see plan_all_to_goal) instead of one search per start;
+  /// no search contexts are used
+  bool plan_all_to_goal = false;
+
+  /// Workers which solve problems, each with its own context; 1 solves them all on the calling thread
+  std::size_t thread_count = 1;
+};
+
+/**
+ * Context and graph types for which some overload of search(ctx, graph, start) exists
+ */
+template<typename C, typename G>
+concept Searchable =
+  requires(C& ctx, const G& graph)
+  {
+      { search(ctx, graph, vertex_id_t{}) } -> std::convertible_to<bool>;
+  };
+
+/**
+ * with_ctx of variants which keep nothing from their contexts
+ */
+struct IgnoreContext
+{
+  template<typename C>
+  void operator()([[maybe_unused]] C& ctx) const {}
 };
 
-template<SearchContext C, SearchGraph G, typename WithContext>
-void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings, WithContext with_ctx);
+/**
+ * Loads a graph, re-orders it, and solves the problems selected by \c settings, saving every path found
+ *
+ * Any \c with_ctx other than IgnoreContext is called with the context after every problem it solves, in
+ * problem order, on one context; it may only be used with a single thread, in search mode, since tree mode
+ * answers problems without contexts.
+ *
+ * \throw std::invalid_argument  if \c with_ctx is given and settings.thread_count is not 1, or settings.plan_all_to_goal is set
+ */
+template<typename C, SearchGraph G, typename WithContext = IgnoreContext>
+  requires Searchable<C, G>
+void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings, WithContext with_ctx = {});
 
 }  // namespace cppcon::demo
\ No newline at end of file
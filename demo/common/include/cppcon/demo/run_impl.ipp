@@ -1,25 +1,50 @@
 #pragma once
 
 // C++ Standard Library
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <filesystem>
+#include <iterator>
 #include <vector>
 #include <iostream>
 #include <numeric>
-#include <random>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
 
 // CppCon
+#include <cppcon/bidirectional_search.h>
+#include <cppcon/goal_tree.h>
 #include <cppcon/search.h>
+#include <cppcon/transpose.h>
+#include <cppcon/demo/parallel.h>
 #include <cppcon/demo/run.h>
+#include <cppcon/demo/topology.h>
 
 namespace cppcon::demo
 {
 
 using Path = std::vector<vertex_id_t>;
 
-template<SearchContext C, SearchGraph G, typename WithContext>
+template<typename C, SearchGraph G, typename WithContext>
+  requires Searchable<C, G>
 void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings, WithContext with_ctx)
 {
+  // Contexts which keep per-problem output (e.g. visited orders) would each keep only part of it, and tree
+  // mode uses no contexts at all
+  if constexpr (!std::is_same_v<WithContext, IgnoreContext>)
+  {
+    if (settings.thread_count != 1)
+    {
+      throw std::invalid_argument{"contexts with per-problem output can only be run on a single thread"};
+    }
+    if (settings.plan_all_to_goal)
+    {
+      throw std::invalid_argument{"contexts with per-problem output can only be run in search mode"};
+    }
+  }
+
   // Load graph from file
   G graph{graph_in_json};
 
@@ -27,43 +52,27 @@ void run(const std::filesystem::path& graph_in_json, const std::filesystem::path
   const std::size_t selected_problems = std::max<std::size_t>(1, settings.percentage_of_problems * total_problems);
   const std::size_t step = std::max<std::size_t>(1, 1.f / std::sqrt(settings.percentage_of_problems));
 
-  // Contatiner to collect all successful results
-  std::vector<Path> results;
-  results.reserve(total_problems);
-
-  // Container to store single resultant path
-  Path path;
-  path.reserve(graph.vertex_count() / 4);
-
-  // Create context that we will reused
-  C ctx;
-
-  std::vector<std::size_t> shuffle_mapping;
-  shuffle_mapping.resize(graph.vertex_count());
-  std::iota(shuffle_mapping.begin(), shuffle_mapping.end(), 0);
-
-  if (settings.shuffle_seed == 0)
+  // Re-order vertices for locality; queries below are posed in external (input) vertex IDs. A graph which is
+  // stored in the requested ordering (see convert_graph) is searched as it is, which keeps a mapped graph mapped
+  const auto ordering = (settings.shuffle_seed == 0) ? settings.ordering : Ordering::kRandom;
+  const auto [stored_ordering, stored] = stored_permutation(graph);
+  const bool is_stored_ordering = (stored_ordering == ordering);
+  const auto reordering = make_permutation(graph, is_stored_ordering ? Ordering::kIdentity : ordering, settings.shuffle_seed);
+  const auto permutation = stored.then(reordering);
   {
-    std::sort(
-      shuffle_mapping.begin(),
-      shuffle_mapping.end(),
-      [&graph](vertex_id_t lhs, vertex_id_t rhs) -> bool
-      {
-        const auto& lv = graph.vertex(lhs);
-        const auto& rv = graph.vertex(rhs);
-        return ((lv.x * lv.x) + (lv.y + lv.y)) < ((rv.x * rv.x) + (rv.y + rv.y));
-      });
+    const auto locality = compute_locality(graph, reordering);
+    std::cerr << "Ordering: " << to_string(ordering) <<
+                 " (average edge span: " << locality.average_edge_span <<
+                 ", bandwidth: " << locality.bandwidth <<
+                 ", same cache line: " << (100.0 * locality.same_cache_line_fraction) <<
+                 "%)" << std::endl;
   }
-  else
+
+  if (!is_stored_ordering)
   {
-    std::shuffle(
-      shuffle_mapping.begin(),
-      shuffle_mapping.end(),
-      std::mt19937{settings.shuffle_seed});
+    graph.shuffle(reordering.indices());
   }
 
-  graph.shuffle(shuffle_mapping);
-
   if (settings.run_search)
   {
     std::cerr << "Running: " << (100.0f * settings.percentage_of_problems) <<
@@ -71,40 +80,114 @@ void run(const std::filesystem::path& graph_in_json, const std::filesystem::path
                  ") of " << total_problems <<
                  " problems" << std::endl;
 
-    const auto t_start = std::chrono::high_resolution_clock::now();
+    // Problems are split by goal; each goal's paths are kept apart so they merge in the same order for any thread count
+    const std::size_t goal_count = (graph.vertex_count() + step - 1) / step;
+    std::vector<std::vector<Path>> goal_results(goal_count);
 
-    // Iterate over all possible "goal" vertices
-    for (vertex_id_t g = 0; g < graph.vertex_count(); g += step)
+    // Workers beyond the first are pinned in topology order from the second CPU on; the calling thread is left
+    // unpinned, so that it keeps its affinity for later runs, and the first CPU is left to it
+    const std::size_t thread_count = std::max<std::size_t>(1, settings.thread_count);
+    const auto cpus = worker_cpu_order();
+    const auto pin_worker = [&cpus](std::size_t w)
     {
-      const auto g_shuffled = shuffle_mapping[g];
+      if (w > 0)
+      {
+        pin_current_thread(cpus[w % cpus.size()]);
+      }
+    };
 
-      ctx.set_goal(g_shuffled);
+    // A single thread searches on the CPU it always has; it is pinned only while searching, so that loading,
+    // shuffling and the threads they start keep every CPU
+    std::optional<ScopedThreadPin> single_thread_pin;
+    if (thread_count == 1)
+    {
+      single_thread_pin.emplace(1);
+    }
 
-      // Iterate over all possible "start" vertices
-      for (vertex_id_t s = 0; s < graph.vertex_count(); s += step)
-      {
-        // Run the search
-        if ((s != g) && search(ctx, graph, shuffle_mapping[s]))
+    const auto t_start = std::chrono::high_resolution_clock::now();
+
+    if (settings.plan_all_to_goal)
+    {
+      // One reverse search per goal answers every start; the context is not used
+      const TransposedGraph reverse_graph{graph};
+      std::vector<GoalTree> trees(thread_count);
+
+      parallel_for_stealing(
+        goal_count,
+        thread_count,
+        [&](std::size_t goal_index, std::size_t w)
         {
-          // On success, store resulting path
-          path.clear();
-          get_reverse_path(std::back_inserter(path), ctx, g_shuffled);
-          std::reverse(path.begin(), path.end());
-          results.emplace_back(std::move(path));
-          with_ctx(ctx);
-        }
-      }
+          const vertex_id_t g = goal_index * step;
+          auto& tree = trees[w];
+          auto& results = goal_results[goal_index];
+          plan_all_to_goal(tree, reverse_graph, permutation.internal(g));
+
+          Path path;
+          for (vertex_id_t s = 0; s < graph.vertex_count(); s += step)
+          {
+            if ((s != g) && get_path_to_goal(std::back_inserter(path), tree, permutation.internal(s)))
+            {
+              results.emplace_back(std::move(path));
+            }
+            path.clear();
+          }
+        },
+        pin_worker);
+    }
+    else
+    {
+      // Every worker re-uses its own context across all of its problems; the graph is shared read-only
+      std::vector<C> contexts(thread_count);
+
+      parallel_for_stealing(
+        goal_count,
+        thread_count,
+        [&](std::size_t goal_index, std::size_t w)
+        {
+          const vertex_id_t g = goal_index * step;
+          const auto g_shuffled = permutation.internal(g);
+          auto& ctx = contexts[w];
+          auto& results = goal_results[goal_index];
+
+          ctx.set_goal(g_shuffled);
+
+          // Iterate over all possible "start" vertices
+          Path path;
+          for (vertex_id_t s = 0; s < graph.vertex_count(); s += step)
+          {
+            // Run the search
+            if ((s != g) && search(ctx, graph, permutation.internal(s)))
+            {
+              // On success, store resulting path
+              path.clear();
+              get_reverse_path(std::back_inserter(path), ctx, g_shuffled);
+              std::reverse(path.begin(), path.end());
+              results.emplace_back(std::move(path));
+              with_ctx(ctx);
+            }
+          }
+        },
+        pin_worker);
     }
 
     const auto t_duration_approx = (std::chrono::high_resolution_clock::now() - t_start);
     const auto t_duration_approx_secs = std::chrono::duration_cast<std::chrono::duration<double>>(t_duration_approx).count();
+    single_thread_pin.reset();
+
+    std::vector<Path> results;
+    results.reserve(selected_problems);
+    for (auto& paths : goal_results)
+    {
+      std::move(paths.begin(), paths.end(), std::back_inserter(results));
+    }
 
     std::cerr << "Solved: " << results.size() <<
                  " of " << selected_problems <<
-                 " problems in: " << t_duration_approx_secs <<
+                 " problems on " << thread_count <<
+                 " thread(s) in: " << t_duration_approx_secs <<
                  " seconds --> " << result_out_json << std::endl;
 
-    save_results(result_out_json, shuffle_mapping, results);
+    save_results(result_out_json, permutation.indices(), results);
   }
 }
 
@@ -0,0 +1,47 @@
+#pragma once
+
+// C++ Standard Library
+#include <vector>
+
+namespace cppcon::demo
+{
+
+/**
+ * Returns the CPUs this process may run on, in the order workers should be pinned to them
+ *
+ * Every physical core of a package comes before the cores of the next package, and only once every
+ * physical core has a worker do workers share a core with an SMT sibling; adding workers therefore adds
+ * whole cores first, and keeps them under as few shared caches as possible. CPUs whose topology is not
+ * reported are treated as cores of their own.
+ */
+std::vector<int> worker_cpu_order();
+
+/**
+ * Restricts the calling thread to \c cpu
+ *
+ * \return false if the thread could not be pinned, or pinning is not supported on this platform
+ */
+bool pin_current_thread(int cpu);
+
+/**
+ * Restricts the calling thread to one CPU for as long as this is alive, then restores its previous affinity
+ *
+ * Does nothing if the thread could not be pinned.
+ */
+class ScopedThreadPin
+{
+public:
+  explicit ScopedThreadPin(int cpu);
+
+  ~ScopedThreadPin();
+
+  ScopedThreadPin(const ScopedThreadPin&) = delete;
+
+  ScopedThreadPin& operator=(const ScopedThreadPin&) = delete;
+
+private:
+  /// CPUs the thread was allowed to run on before it was pinned; empty if it was not pinned
+  std::vector<int> previous_cpus_;
+};
+
+}  // namespace cppcon::demo
@@ -0,0 +1,89 @@
+// C++ Standard Library
+#include <algorithm>
+#include <numeric>
+
+// CppCon
+#include <cppcon/demo/csr.h>
+#include <cppcon/demo/graph_json.h>
+#include <cppcon/demo/permute.h>
+
+namespace cppcon::demo
+{
+
+CSRData load_csr_from_json(const std::filesystem::path& path)
+{
+  const GraphJsonReader reader{path};
+
+  CSRData csr;
+
+  reader.for_each_node([&csr](const VertexProperties& vertex) { csr.vertices.push_back(vertex); });
+
+  // Edges are parsed twice, once per pass, so that they are never all held at once alongside the CSR arrays
+
+  // Count out-degree of every vertex, shifted by one so that an inclusive scan yields start offsets
+  csr.offsets.resize(csr.vertices.size() + 1, 0);
+  reader.for_each_edge([&csr](const EdgeRecord& edge) { ++csr.offsets[edge.u + 1]; });
+  std::partial_sum(csr.offsets.begin(), csr.offsets.end(), csr.offsets.begin());
+
+  // Scatter edges into place, keeping file order within each adjacency
+  std::vector<edge_offset_t> cursor{csr.offsets.begin(), csr.offsets.end() - 1};
+  csr.edges.resize(csr.offsets.back(), Edge{0, EdgeProperties{0}});
+  reader.for_each_edge([&csr, &cursor](const EdgeRecord& edge) { csr.edges[cursor[edge.u]++] = Edge{edge.v, EdgeProperties{edge.weight}}; });
+
+  return csr;
+}
+
+CSRData load_csr(const std::filesystem::path& path)
+{
+  if (!is_graph_file(path))
+  {
+    return load_csr_from_json(path);
+  }
+
+  const MappedFile file{path};
+  const GraphFileView view{file};
+  if (!view.input_ids().empty())
+  {
+    // Stored re-ordered; move every vertex back to its input ID
+    return permute_csr(view.vertices(), view.offsets(), view.edges(), {view.input_ids().begin(), view.input_ids().end()});
+  }
+  return CSRData{
+    .vertices = {view.vertices().begin(), view.vertices().end()},
+    .offsets = {view.offsets().begin(), view.offsets().end()},
+    .edges = {view.edges().begin(), view.edges().end()},
+  };
+}
+
+CSRData permute_csr(
+  std::span<const VertexProperties> vertices,
+  std::span<const edge_offset_t> offsets,
+  std::span<const Edge> edges,
+  const std::vector<std::size_t>& indices,
+  std::size_t thread_count)
+{
+  CSRData csr;
+  csr.vertices = permute_vertices(std::vector<VertexProperties>{vertices.begin(), vertices.end()}, indices, thread_count);
+  csr.offsets = permute_offsets(
+    indices,
+    [offsets](vertex_id_t pred) { return offsets[pred + 1] - offsets[pred]; },
+    thread_count);
+  csr.edges = permute_edges(
+    indices,
+    csr.offsets,
+    [offsets, edges, &indices](vertex_id_t pred, auto out)
+    {
+      std::transform(
+        edges.begin() + offsets[pred],
+        edges.begin() + offsets[pred + 1],
+        out,
+        [&indices](const Edge& edge) -> Edge
+        {
+          return {static_cast<vertex_id_t>(indices[edge.first]), edge.second};
+        });
+    },
+    Edge{0, EdgeProperties{0}},
+    thread_count);
+  return csr;
+}
+
+}  // namespace cppcon::demo
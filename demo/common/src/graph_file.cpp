@@ -0,0 +1,233 @@
+// C++ Standard Library
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// CppCon
+#include <cppcon/demo/graph_file.h>
+
+namespace cppcon::demo
+{
+namespace
+{
+
+constexpr std::uint32_t kByteOrderTag = 0x01020304;
+
+constexpr std::uint64_t align_up(std::uint64_t n)
+{
+  return (n + kGraphFileAlignment - 1) / kGraphFileAlignment * kGraphFileAlignment;
+}
+
+template<typename T>
+std::span<const T> get_section(const MappedFile& file, const GraphFileSection& section, std::size_t count)
+{
+  // Counts and offsets come from the file, so every product and sum is checked for overflow
+  std::uint64_t size;
+  std::uint64_t end;
+  if (__builtin_mul_overflow(count, sizeof(T), &size) or
+      __builtin_add_overflow(section.offset, section.size, &end) or
+      section.size != size or section.offset % alignof(T) != 0 or end > file.size())
+  {
+    throw std::runtime_error{"graph file section is out of bounds or misaligned"};
+  }
+  return {reinterpret_cast<const T*>(file.data() + section.offset), count};
+}
+
+}  // namespace
+
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    throw std::runtime_error{"failed to open: " + path.string()};
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0)
+  {
+    ::close(fd);
+    throw std::runtime_error{"failed to stat: " + path.string()};
+  }
+
+  size_ = static_cast<std::size_t>(st.st_size);
+  if (size_ > 0)
+  {
+    void* const addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED)
+    {
+      ::close(fd);
+      throw std::runtime_error{"failed to map: " + path.string()};
+    }
+    data_ = static_cast<std::byte*>(addr);
+  }
+  ::close(fd);
+}
+
+MappedFile::MappedFile(MappedFile&& other) :
+  data_{std::exchange(other.data_, nullptr)},
+  size_{std::exchange(other.size_, 0)}
+{}
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+  if (this != &other)
+  {
+    MappedFile{std::move(*this)};
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile()
+{
+  if (data_ != nullptr)
+  {
+    ::munmap(data_, size_);
+  }
+}
+
+GraphFileView::GraphFileView(const MappedFile& file)
+{
+  GraphFileHeader header;
+  if (file.size() < sizeof(header))
+  {
+    throw std::runtime_error{"graph file is too small to hold a header"};
+  }
+  std::memcpy(&header, file.data(), sizeof(header));
+
+  if (std::memcmp(header.magic, kGraphFileMagic, sizeof(kGraphFileMagic)) != 0)
+  {
+    throw std::runtime_error{"not a graph file"};
+  }
+  if (header.version != kGraphFileVersion)
+  {
+    throw std::runtime_error{"unsupported graph file version: " + std::to_string(header.version)};
+  }
+  if (header.byte_order_tag != kByteOrderTag or
+      header.vertex_record_size != sizeof(VertexProperties) or
+      header.edge_record_size != sizeof(Edge))
+  {
+    throw std::runtime_error{"graph file was written with an incompatible record layout"};
+  }
+
+  vertices_ = get_section<VertexProperties>(file, header.vertices, header.vertex_count);
+  offsets_ = get_section<edge_offset_t>(file, header.offsets, header.vertex_count + 1);
+  edges_ = get_section<Edge>(file, header.edges, header.edge_count);
+
+  if (offsets_.front() != 0 or offsets_.back() != edges_.size() or !std::is_sorted(offsets_.begin(), offsets_.end()))
+  {
+    throw std::runtime_error{"graph file has malformed edge offsets"};
+  }
+  if (std::any_of(edges_.begin(), edges_.end(), [n=vertices_.size()](const Edge& edge) { return edge.first >= n; }))
+  {
+    throw std::runtime_error{"graph file has edges to vertices which do not exist"};
+  }
+
+  if (header.ordering > static_cast<std::uint64_t>(Ordering::kDepthFirst))
+  {
+    throw std::runtime_error{"graph file has an unknown vertex ordering: " + std::to_string(header.ordering)};
+  }
+  ordering_ = static_cast<Ordering>(header.ordering);
+  if (ordering_ != Ordering::kIdentity)
+  {
+    input_ids_ = get_section<vertex_id_t>(file, header.input_ids, header.vertex_count);
+
+    // Input IDs must be a permutation, since they index per-vertex arrays
+    std::vector<bool> seen(input_ids_.size(), false);
+    for (const vertex_id_t id : input_ids_)
+    {
+      if (id >= seen.size() or seen[id])
+      {
+        throw std::runtime_error{"graph file has malformed input vertex IDs"};
+      }
+      seen[id] = true;
+    }
+  }
+}
+
+bool is_graph_file(const std::filesystem::path& path)
+{
+  std::ifstream ifs{path, std::ios::binary};
+  char magic[sizeof(kGraphFileMagic)] = {};
+  ifs.read(magic, sizeof(magic));
+  return ifs and std::memcmp(magic, kGraphFileMagic, sizeof(kGraphFileMagic)) == 0;
+}
+
+void write_graph_file(
+  const std::filesystem::path& path,
+  std::span<const VertexProperties> vertices,
+  std::span<const edge_offset_t> offsets,
+  std::span<const Edge> edges,
+  Ordering ordering,
+  std::span<const vertex_id_t> input_ids)
+{
+  if (offsets.size() != vertices.size() + 1 or offsets.back() != edges.size())
+  {
+    throw std::invalid_argument{"edge offsets do not match vertex and edge counts"};
+  }
+  if ((ordering == Ordering::kIdentity) ? !input_ids.empty() : (input_ids.size() != vertices.size()))
+  {
+    throw std::invalid_argument{"input vertex IDs do not match the vertex ordering"};
+  }
+
+  GraphFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kGraphFileMagic, sizeof(kGraphFileMagic));
+  header.version = kGraphFileVersion;
+  header.byte_order_tag = kByteOrderTag;
+  header.vertex_record_size = sizeof(VertexProperties);
+  header.edge_record_size = sizeof(Edge);
+  header.vertex_count = vertices.size();
+  header.edge_count = edges.size();
+  header.vertices = {align_up(sizeof(header)), vertices.size_bytes()};
+  header.offsets = {align_up(header.vertices.offset + header.vertices.size), offsets.size_bytes()};
+  header.edges = {align_up(header.offsets.offset + header.offsets.size), edges.size_bytes()};
+  header.ordering = static_cast<std::uint64_t>(ordering);
+  header.input_ids = {align_up(header.edges.offset + header.edges.size), input_ids.size_bytes()};
+
+  std::ofstream ofs{path, std::ios::binary};
+  if (!ofs)
+  {
+    throw std::runtime_error{"failed to open for writing: " + path.string()};
+  }
+
+  const auto write_at = [&ofs](std::uint64_t offset, const void* data, std::size_t size)
+  {
+    static constexpr char kPadding[kGraphFileAlignment] = {};
+    ofs.write(kPadding, offset - static_cast<std::uint64_t>(ofs.tellp()));
+    ofs.write(static_cast<const char*>(data), size);
+  };
+
+  // Edges are written one at a time so that padding bytes within each record are zeroed
+  write_at(0, &header, sizeof(header));
+  write_at(header.vertices.offset, vertices.data(), vertices.size_bytes());
+  write_at(header.offsets.offset, offsets.data(), offsets.size_bytes());
+  write_at(header.edges.offset, nullptr, 0);
+  for (const auto& [succ, props] : edges)
+  {
+    alignas(Edge) std::byte record[sizeof(Edge)] = {};
+    ::new (record) Edge{succ, props};
+    ofs.write(reinterpret_cast<const char*>(record), sizeof(record));
+  }
+  write_at(header.input_ids.offset, input_ids.data(), input_ids.size_bytes());
+
+  if (!ofs)
+  {
+    throw std::runtime_error{"failed to write: " + path.string()};
+  }
+}
+
+}  // namespace cppcon::demo
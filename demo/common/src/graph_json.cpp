@@ -0,0 +1,348 @@
+// C++ Standard Library
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+// CppCon
+#include <cppcon/demo/graph_json.h>
+
+namespace cppcon::demo
+{
+namespace
+{
+
+[[noreturn]] void throw_parse_error(std::string_view text, const char* what)
+{
+  throw std::runtime_error{std::string{"graph JSON: "} + what + " near: '" + std::string{text.substr(0, 32)} + "'"};
+}
+
+void skip_whitespace(std::string_view& text)
+{
+  const auto n = text.find_first_not_of(" \t\r\n");
+  text.remove_prefix(std::min(n, text.size()));
+}
+
+bool consume(std::string_view& text, char c)
+{
+  skip_whitespace(text);
+  if (text.empty() or text.front() != c)
+  {
+    return false;
+  }
+  text.remove_prefix(1);
+  return true;
+}
+
+void expect(std::string_view& text, char c)
+{
+  if (!consume(text, c))
+  {
+    throw_parse_error(text, "unexpected character");
+  }
+}
+
+std::string_view parse_string(std::string_view& text)
+{
+  expect(text, '"');
+  for (std::size_t i = 0; i < text.size(); ++i)
+  {
+    if (text[i] == '\\')
+    {
+      ++i;
+    }
+    else if (text[i] == '"')
+    {
+      const auto str = text.substr(0, i);
+      text.remove_prefix(i + 1);
+      return str;
+    }
+  }
+  throw_parse_error(text, "unterminated string");
+}
+
+void skip_value(std::string_view& text)
+{
+  skip_whitespace(text);
+  if (text.empty())
+  {
+    throw_parse_error(text, "unexpected end of input");
+  }
+  else if (text.front() == '"')
+  {
+    parse_string(text);
+  }
+  else if (text.front() == '{' or text.front() == '[')
+  {
+    std::size_t depth = 0;
+    while (!text.empty())
+    {
+      const char c = text.front();
+      if (c == '"')
+      {
+        parse_string(text);
+        continue;
+      }
+      text.remove_prefix(1);
+      if (c == '{' or c == '[')
+      {
+        ++depth;
+      }
+      else if ((c == '}' or c == ']') and --depth == 0)
+      {
+        return;
+      }
+    }
+    throw_parse_error(text, "unterminated object or array");
+  }
+  else
+  {
+    const auto n = text.find_first_of(",}] \t\r\n");
+    text.remove_prefix(std::min(n, text.size()));
+  }
+}
+
+double parse_double(std::string_view& text)
+{
+  skip_whitespace(text);
+  double value;
+  const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+  if (ec != std::errc{})
+  {
+    throw_parse_error(text, "expected a number");
+  }
+  text.remove_prefix(ptr - text.data());
+  return value;
+}
+
+/**
+ * Reads the integer part of a non-negative number, discarding any fraction
+ */
+std::uint32_t parse_integral(std::string_view& text)
+{
+  skip_whitespace(text);
+  const auto* const first = text.data();
+  const auto* const last = text.data() + text.size();
+
+  std::uint32_t value;
+  auto [ptr, ec] = std::from_chars(first, last, value);
+  if (ec != std::errc{})
+  {
+    throw_parse_error(text, "expected a non-negative integer");
+  }
+
+  if (ptr != last and *ptr == '.')
+  {
+    ptr = std::find_if_not(ptr + 1, last, [](char c) { return c >= '0' and c <= '9'; });
+  }
+
+  // Fall back to a floating point parse for values in exponent notation
+  if (ptr != last and (*ptr == 'e' or *ptr == 'E'))
+  {
+    return static_cast<std::uint32_t>(parse_double(text));
+  }
+
+  text.remove_prefix(ptr - first);
+  return value;
+}
+
+/**
+ * Parses the next element of an array, returning false once the end of the text or array is reached
+ */
+template<typename MemberFnT>
+bool next_object(std::string_view& text, MemberFnT&& on_member)
+{
+  consume(text, ',');
+  skip_whitespace(text);
+  if (text.empty() or text.front() == ']')
+  {
+    return false;
+  }
+
+  expect(text, '{');
+  if (consume(text, '}'))
+  {
+    return true;
+  }
+  do
+  {
+    const auto key = parse_string(text);
+    expect(text, ':');
+    on_member(key, text);
+  }
+  while (consume(text, ','));
+  expect(text, '}');
+  return true;
+}
+
+void parse_edge_chunk(std::string_view text, std::vector<EdgeRecord>& edges)
+{
+  edges.clear();
+  edges.reserve(text.size() / 32);
+
+  // Each record starts empty, so that a missing member is an error rather than the previous record's value
+  EdgeRecord edge;
+  bool has_u, has_v, has_weight;
+  const auto on_member = [&](std::string_view key, std::string_view& value)
+  {
+    if (key == "u")
+    {
+      edge.u = parse_integral(value);
+      has_u = true;
+    }
+    else if (key == "v")
+    {
+      edge.v = parse_integral(value);
+      has_v = true;
+    }
+    else if (key == "w")
+    {
+      edge.weight = std::max<edge_weight_t>(1, parse_integral(value));
+      has_weight = true;
+    }
+    else
+    {
+      skip_value(value);
+    }
+  };
+
+  for (;;)
+  {
+    edge = EdgeRecord{0, 0, 0};
+    has_u = has_v = has_weight = false;
+    if (!next_object(text, on_member))
+    {
+      break;
+    }
+    if (!has_u or !has_v or !has_weight)
+    {
+      throw_parse_error(text, "edge record without 'u', 'v' and 'w'");
+    }
+    edges.push_back(edge);
+  }
+}
+
+/**
+ * Moves a chunk boundary forward to just past the end of the record which contains it
+ *
+ * Edge records are flat objects, so the next closing brace ends the current record
+ */
+std::size_t align_to_record(std::string_view text, std::size_t pos)
+{
+  const auto n = text.find('}', pos);
+  return (n == std::string_view::npos) ? text.size() : (n + 1);
+}
+
+}  // namespace
+
+GraphJsonReader::GraphJsonReader(const std::filesystem::path& path) :
+  file_{path}
+{
+  std::string_view text{reinterpret_cast<const char*>(file_.data()), file_.size()};
+
+  expect(text, '{');
+  do
+  {
+    const auto key = parse_string(text);
+    expect(text, ':');
+    skip_whitespace(text);
+
+    const auto value_first = text.data();
+    skip_value(text);
+    const std::string_view value{value_first, static_cast<std::size_t>(text.data() - value_first)};
+
+    if (key == "nodes")
+    {
+      nodes_ = value;
+    }
+    else if (key == "edges")
+    {
+      edges_ = value;
+    }
+  }
+  while (consume(text, ','));
+  expect(text, '}');
+
+  if (!consume(nodes_, '[') or !consume(edges_, '['))
+  {
+    throw std::runtime_error{"graph JSON: expected 'nodes' and 'edges' arrays in: " + path.string()};
+  }
+}
+
+bool GraphJsonReader::next_node(std::string_view& text, VertexProperties& vertex)
+{
+  vertex = VertexProperties{0, 0};
+  bool has_x = false;
+  bool has_y = false;
+  const bool found = next_object(
+    text,
+    [&](std::string_view key, std::string_view& value)
+    {
+      if (key == "x")
+      {
+        vertex.x = parse_double(value);
+        has_x = true;
+      }
+      else if (key == "y")
+      {
+        vertex.y = parse_double(value);
+        has_y = true;
+      }
+      else
+      {
+        skip_value(value);
+      }
+    });
+  if (found and (!has_x or !has_y))
+  {
+    throw_parse_error(text, "node record without 'x' and 'y'");
+  }
+  return found;
+}
+
+bool GraphJsonReader::parse_edge_window(std::string_view& text, std::vector<std::vector<EdgeRecord>>& chunks, std::size_t thread_count)
+{
+  // Keep chunks large enough that thread start-up does not dominate, and windows small enough that their
+  // records stay a small fraction of the finished graph
+  static constexpr std::size_t kMinChunkSize = 1 << 16;
+  static constexpr std::size_t kMaxWindowSize = 1 << 22;
+
+  // The previous window ended with a record, so a separator may come first
+  consume(text, ',');
+  skip_whitespace(text);
+  if (text.empty() or (text.front() == ']'))
+  {
+    return false;
+  }
+
+  const auto window = text.substr(0, align_to_record(text, std::min(text.size(), kMaxWindowSize) - 1));
+  text.remove_prefix(window.size());
+
+  const std::size_t chunk_count = std::max<std::size_t>(1, std::min(thread_count, window.size() / kMinChunkSize));
+
+  std::vector<std::size_t> boundaries;
+  boundaries.reserve(chunk_count + 1);
+  boundaries.push_back(0);
+  for (std::size_t c = 1; c < chunk_count; ++c)
+  {
+    const std::size_t pos = std::max(boundaries.back(), c * window.size() / chunk_count);
+    boundaries.push_back(align_to_record(window, pos));
+  }
+  boundaries.push_back(window.size());
+
+  chunks.resize(chunk_count);
+  parallel_for_ranges(
+    chunk_count,
+    chunk_count,
+    [window, &boundaries, &chunks](std::size_t first, std::size_t last, [[maybe_unused]] std::size_t range_index)
+    {
+      for (std::size_t c = first; c < last; ++c)
+      {
+        parse_edge_chunk(window.substr(boundaries[c], boundaries[c + 1] - boundaries[c]), chunks[c]);
+      }
+    });
+  return true;
+}
+
+}  // namespace cppcon::demo
@@ -0,0 +1,143 @@
+#ifdef __linux__    // Linux only
+#include <sched.h>  // sched_getaffinity, sched_setaffinity
+#endif
+
+// C++ Standard Library
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <tuple>
+
+// CppCon
+#include <cppcon/demo/topology.h>
+
+namespace cppcon::demo
+{
+namespace
+{
+
+/**
+ * Returns the integer in /sys/devices/system/cpu/cpu<cpu>/topology/<name>, or \c fallback if there is none
+ */
+int read_topology(int cpu, const char* name, int fallback)
+{
+  std::ifstream ifs{"/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + name};
+  int value;
+  return (ifs >> value) ? value : fallback;
+}
+
+/**
+ * Returns the CPUs the calling thread may run on, or nothing if that is not reported on this platform
+ */
+std::vector<int> current_thread_cpus()
+{
+  std::vector<int> cpus;
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+  {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+      if (CPU_ISSET(cpu, &mask))
+      {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  return cpus;
+}
+
+}  // namespace
+
+std::vector<int> worker_cpu_order()
+{
+  std::vector<int> cpus = current_thread_cpus();
+  if (cpus.empty())
+  {
+    for (int cpu = 0; cpu < static_cast<int>(std::max(1U, std::thread::hardware_concurrency())); ++cpu)
+    {
+      cpus.push_back(cpu);
+    }
+  }
+
+  struct Placement
+  {
+    int package;
+    int core;
+    int sibling;
+    int cpu;
+  };
+
+  std::vector<Placement> placements;
+  for (const int cpu : cpus)
+  {
+    placements.push_back(Placement{.package = read_topology(cpu, "physical_package_id", 0), .core = read_topology(cpu, "core_id", cpu), .sibling = 0, .cpu = cpu});
+  }
+
+  // Number the SMT siblings of each core by CPU index, which is the order cpus is already in
+  for (std::size_t i = 0; i < placements.size(); ++i)
+  {
+    for (std::size_t j = 0; j < i; ++j)
+    {
+      placements[i].sibling += (placements[j].package == placements[i].package) and (placements[j].core == placements[i].core);
+    }
+  }
+
+  std::sort(
+    placements.begin(),
+    placements.end(),
+    [](const Placement& lhs, const Placement& rhs)
+    {
+      return std::tie(lhs.sibling, lhs.package, lhs.core, lhs.cpu) < std::tie(rhs.sibling, rhs.package, rhs.core, rhs.cpu);
+    });
+
+  std::vector<int> order;
+  order.reserve(placements.size());
+  for (const auto& placement : placements)
+  {
+    order.push_back(placement.cpu);
+  }
+  return order;
+}
+
+bool pin_current_thread([[maybe_unused]] int cpu)
+{
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(cpu, &mask);
+  return sched_setaffinity(0, sizeof(mask), &mask) == 0;
+#else
+  return false;
+#endif
+}
+
+ScopedThreadPin::ScopedThreadPin(int cpu) :
+  previous_cpus_{current_thread_cpus()}
+{
+  if (!pin_current_thread(cpu))
+  {
+    previous_cpus_.clear();
+  }
+}
+
+ScopedThreadPin::~ScopedThreadPin()
+{
+#ifdef __linux__
+  if (!previous_cpus_.empty())
+  {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (const int cpu : previous_cpus_)
+    {
+      CPU_SET(cpu, &mask);
+    }
+    sched_setaffinity(0, sizeof(mask), &mask);
+  }
+#endif
+}
+
+}  // namespace cppcon::demo
@@ -3,43 +3,27 @@
 
 // CppCon
 #include <cppcon/demo/v1/graph.h>
-#include <cppcon/demo/json.h>
+#include <cppcon/demo/graph_json.h>
 
 namespace cppcon::demo::v1
 {
 
 Graph::Graph(const std::filesystem::path& graph_file_name)
 {
-  const auto v = load_json(graph_file_name);
-  const auto& root = v.get<picojson::object>();
-  const auto& nodes = root.at("nodes").get<picojson::array>();
+  const GraphJsonReader reader{graph_file_name};
 
-  for (const auto& node_value : nodes)
-  {
-    const auto& node_object = node_value.get<picojson::object>();
-    this->vertices_.emplace(
-      this->vertices_.size(),
-      VertexProperties{
-      .x = node_object.at("x").get<double>(),
-      .y = node_object.at("y").get<double>(),
-    });
-  }
+  reader.for_each_node([this](const VertexProperties& vertex) { this->vertices_.emplace(this->vertices_.size(), vertex); });
 
-  const auto& edges = root.at("edges").get<picojson::array>();
   this->adjacencies_.reserve(this->vertices_.size());
-  for (const auto& edge_value : edges)
-  {
-    const auto& edge_object = edge_value.get<picojson::object>();
-    const vertex_id_t pred = edge_object.at("u").get<double>();
-    const vertex_id_t succ = edge_object.at("v").get<double>();
-    const edge_weight_t weight = std::max<edge_weight_t>(1, edge_object.at("w").get<double>());
-
-    this->adjacencies_.emplace(
-      std::piecewise_construct,
-      std::forward_as_tuple(pred),
-      std::forward_as_tuple(succ, weight)
-    );
-  }
+  reader.for_each_edge(
+    [this](const EdgeRecord& edge)
+    {
+      this->adjacencies_.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(edge.u),
+        std::forward_as_tuple(edge.v, edge.weight)
+      );
+    });
 }
 
 void Graph::shuffle(const std::vector<std::size_t>& indices)
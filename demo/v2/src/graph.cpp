@@ -3,39 +3,23 @@
 
 // CppCon
 #include <cppcon/demo/v2/graph.h>
-#include <cppcon/demo/json.h>
+#include <cppcon/demo/graph_json.h>
 
 namespace cppcon::demo::v2
 {
 
 Graph::Graph(const std::filesystem::path& graph_file_name)
 {
-  const auto v = load_json(graph_file_name);
-  const auto& root = v.get<picojson::object>();
-  const auto& nodes = root.at("nodes").get<picojson::array>();
+  const GraphJsonReader reader{graph_file_name};
 
-  this->vertices_.reserve(nodes.size());
-  for (const auto& node_value : nodes)
-  {
-    const auto& node_object = node_value.get<picojson::object>();
-
-    this->vertices_.push_back(VertexProperties{
-      .x = node_object.at("x").get<double>(),
-      .y = node_object.at("y").get<double>(),
-    });
-  }
+  reader.for_each_node([this](const VertexProperties& vertex) { this->vertices_.push_back(vertex); });
 
   this->adjacencies_.resize(this->vertices_.size());
-  const auto& edges = root.at("edges").get<picojson::array>();
-  for (const auto& edge_value : edges)
-  {
-    const auto& edge_object = edge_value.get<picojson::object>();
-    const vertex_id_t from = edge_object.at("u").get<double>();
-    const vertex_id_t to = edge_object.at("v").get<double>();
-    const edge_weight_t weight = std::max<edge_weight_t>(1, edge_object.at("w").get<double>());
-
-    this->adjacencies_[from].emplace_back(to, weight);
-  }
+  reader.for_each_edge(
+    [this](const EdgeRecord& edge)
+    {
+      this->adjacencies_[edge.u].emplace_back(edge.v, edge.weight);
+    });
 }
 
 void Graph::shuffle(const std::vector<std::size_t>& indices)
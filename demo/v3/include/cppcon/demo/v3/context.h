@@ -8,6 +8,7 @@
 #include <vector>
 
 // CppCon
+#include <cppcon/prefetch.h>
 #include <cppcon/search.h>
 
 namespace cppcon::demo::v3
@@ -19,9 +20,14 @@ struct MinQueue : std::priority_queue<T, std::vector<T>, std::greater<T>>
   using Base = std::priority_queue<T, std::vector<T>, std::greater<T>>;
   using Base::Base;
   std::vector<T>& underlying() { return Base::c; }
+  const std::vector<T>& underlying() const { return Base::c; }
 };
 
-class TerminateAtGoal
+/**
+ * \param PrefetchT  policy which chooses what to prefetch from the queue after every de-queue (see HeapTopPrefetch)
+ */
+template<typename PrefetchT = NoPrefetch>
+class BasicTerminateAtGoal
 {
 public:
   void set_goal(vertex_id_t g) { goal_ = g; }
@@ -46,11 +52,23 @@ public:
 
   void mark_visited(vertex_id_t p, vertex_id_t s) { visited_[s] = p; }
 
+  void prefetch_visited(vertex_id_t q) const { __builtin_prefetch(visited_.data() + q); }
+
   vertex_id_t predecessor(vertex_id_t q) const
   {
     return visited_[q];
   }
 
+  /**
+   * Prefetches what settling the next few queued vertices will read, as chosen by PrefetchT
+   */
+  template<PrefetchingSearchGraph G>
+    requires PrefetchT::kEnabled
+  void prefetch_frontier(const G& graph) const
+  {
+    PrefetchT::prefetch(queue_.underlying(), graph, visited_.data());
+  }
+
   Transition dequeue()
   {
     auto t = queue_.top();
@@ -76,5 +94,6 @@ private:
   std::vector<vertex_id_t> visited_;
 };
 
+using TerminateAtGoal = BasicTerminateAtGoal<>;
 
 }  // namespace cppcon::demo::v3
\ No newline at end of file
@@ -37,6 +37,10 @@ public:
       });
   }
 
+  void prefetch_adjacency(vertex_id_t q) const { __builtin_prefetch(adjacencies_.data() + q); }
+
+  void prefetch_edges(vertex_id_t q) const { __builtin_prefetch(adjacencies_[q].begin()); }
+
 private:
   std::vector<VertexProperties> vertices_;
   std::vector<std::ranges::subrange<const Edge*>> adjacencies_;
@@ -0,0 +1,82 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/v3_cpd/path_database.h>
+
+namespace cppcon::demo::v3_cpd
+{
+
+template <typename T>
+concept PathDatabaseSearchGraph =
+  SearchGraph<T> and
+  requires(T&& g)
+  {
+      { g.path_database() } -> std::convertible_to<const PathDatabase&>;
+      { g.successor(vertex_id_t{}, std::uint8_t{}) } -> std::convertible_to<vertex_id_t>;
+  };
+
+/**
+ * Path read back from a path database, one first-move lookup per vertex along the way
+ */
+class TerminateAtGoal
+{
+public:
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  vertex_id_t goal() const { return goal_; }
+
+private:
+  template<PathDatabaseSearchGraph G>
+  friend bool search(TerminateAtGoal& ctx, const G& graph, vertex_id_t start);
+
+  template<typename OutputIteratorT>
+  friend OutputIteratorT get_reverse_path(OutputIteratorT out, const TerminateAtGoal& ctx, vertex_id_t goal);
+
+  vertex_id_t goal_ = 0;
+
+  std::vector<vertex_id_t> path_;
+};
+
+
+/**
+ * Follows first moves from \c start to the goal of \c ctx; no search is run
+ */
+template<PathDatabaseSearchGraph G>
+bool search(TerminateAtGoal& ctx, const G& graph, vertex_id_t start)
+{
+  const PathDatabase& database = graph.path_database();
+
+  ctx.path_.clear();
+  ctx.path_.push_back(start);
+
+  // Zero-weight cycles could otherwise be followed forever
+  for (vertex_id_t q = start; q != ctx.goal_; ctx.path_.push_back(q))
+  {
+    const std::uint8_t move = database.first_move(q, ctx.goal_);
+    if (move == PathDatabase::kNoMove or ctx.path_.size() > graph.vertex_count())
+    {
+      return false;
+    }
+    q = graph.successor(q, move);
+  }
+  return true;
+}
+
+
+/**
+ * Writes the path found by the last search from the goal back to the start
+ */
+template<typename OutputIteratorT>
+OutputIteratorT get_reverse_path(OutputIteratorT out, const TerminateAtGoal& ctx, [[maybe_unused]] vertex_id_t goal)
+{
+  return std::copy(ctx.path_.rbegin(), ctx.path_.rend(), out);
+}
+
+}  // namespace cppcon::demo::v3_cpd
@@ -0,0 +1,55 @@
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/v3_csr/graph.h>
+#include <cppcon/demo/v3_cpd/path_database.h>
+
+namespace cppcon::demo::v3_cpd
+{
+
+/**
+ * v3_csr::Graph with a compressed path database
+ *
+ * The database is kept beside the graph file, as "<graph_file_name>.cpd", and mapped from there when it is
+ * at least as new as the graph; otherwise it is rebuilt and written back.
+ */
+class Graph
+{
+public:
+  explicit Graph(const std::filesystem::path& graph_file_name);
+
+  void shuffle(const std::vector<std::size_t>& indices);
+
+  const VertexProperties& vertex(vertex_id_t q) const { return graph_.vertex(q); }
+
+  std::size_t vertex_count() const { return graph_.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph_.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  /**
+   * Returns the vertex reached by taking edge \c move of \c q, as numbered by the path database
+   */
+  vertex_id_t successor(vertex_id_t q, std::uint8_t move) const
+  {
+    const auto view = graph_.view();
+    return view.edges()[view.offsets()[q] + move].first;
+  }
+
+  const PathDatabase& path_database() const { return database_; }
+
+private:
+  v3_csr::Graph graph_;
+  PathDatabase database_;
+};
+
+}  // namespace cppcon::demo::v3_cpd
@@ -0,0 +1,141 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <span>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/graph_file.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+namespace cppcon::demo::v3_cpd
+{
+
+/**
+ * Binary path database file layout (host byte order, every section aligned to kGraphFileAlignment):
+ *
+ *   PathDatabaseHeader
+ *   vertex_id_t[vertex_count]          <-- 'positions' section; position of each vertex in row order
+ *   std::uint64_t[vertex_count + 1]    <-- 'row_offsets' section; runs of the source at position p are [row_offsets[p], row_offsets[p + 1])
+ *   std::uint32_t[run_count]           <-- 'runs' section; (position of the first target << 8) | move
+ *
+ * As with graph files, records are stored exactly as they are laid out in memory so that a mapped file can
+ * be used in-place. The header also holds the edge count and a hash of the graph the database was built
+ * from, so that a database left over from a different graph is not used.
+ */
+constexpr std::uint32_t kPathDatabaseFileVersion = 2;
+
+constexpr char kPathDatabaseFileMagic[8] = {'C', 'P', 'P', 'C', 'O', 'N', 'P', 'D'};
+
+struct PathDatabaseHeader
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order_tag;
+  std::uint64_t vertex_count;
+  std::uint64_t run_count;
+  std::uint64_t edge_count;
+  std::uint64_t graph_hash;
+  GraphFileSection positions;
+  GraphFileSection row_offsets;
+  GraphFileSection runs;
+};
+
+/**
+ * First move along a shortest path from every source to every target, as a compressed path database
+ *
+ * A move is the index of an edge within the adjacency of its source. Targets are numbered by position along
+ * a Hilbert curve, so nearby targets, which are usually reached through the same edge, are adjacent in each
+ * row; rows store only the positions at which the move changes. Paths are read back by looking up the first
+ * move from each vertex along the way, without searching.
+ */
+class PathDatabase
+{
+public:
+  /// Move to targets which cannot be reached, or to the source itself
+  static constexpr std::uint8_t kNoMove = 0xFF;
+
+  /// Runs hold target positions in 24 bits
+  static constexpr std::size_t kMaxVertexCount = std::size_t{1} << 24;
+
+  PathDatabase() = default;
+
+  /**
+   * Runs a Dijkstra search from every vertex of \c graph, split across \c thread_count threads
+   */
+  PathDatabase(const v3_csr::GraphView& graph, std::size_t thread_count);
+
+  /**
+   * Maps a database written by save()
+   */
+  explicit PathDatabase(const std::filesystem::path& path);
+
+  /**
+   * Writes the database to \c path atomically, replacing any database there only once it is complete
+   */
+  void save(const std::filesystem::path& path) const;
+
+  /**
+   * Returns a hash of the edge offsets and of the successor, validity and weight of every edge of \c graph
+   */
+  static std::uint64_t graph_hash(const v3_csr::GraphView& graph);
+
+  /**
+   * Returns true if this database was built from a graph with the same edges as \c graph, in the same order
+   */
+  bool is_built_for(const v3_csr::GraphView& graph) const
+  {
+    return vertex_count() == graph.vertex_count() and edge_count_ == graph.edge_count() and graph_hash_ == graph_hash(graph);
+  }
+
+  /**
+   * Returns the index of the first edge from \c s along a shortest path to \c t, or kNoMove
+   */
+  std::uint8_t first_move(vertex_id_t s, vertex_id_t t) const
+  {
+    // Find the last run which starts at or before the target
+    const auto first = runs_.begin() + row_offsets_[positions_[s]];
+    const auto last = runs_.begin() + row_offsets_[positions_[s] + 1];
+    const auto itr = std::upper_bound(first, last, (std::uint32_t{positions_[t]} << 8) | kMoveMask);
+    return (itr == first) ? kNoMove : static_cast<std::uint8_t>(*std::prev(itr) & kMoveMask);
+  }
+
+  std::size_t vertex_count() const { return positions_.size(); }
+
+  std::size_t run_count() const { return runs_.size(); }
+
+  std::size_t memory_bytes() const { return positions_.size_bytes() + row_offsets_.size_bytes() + runs_.size_bytes(); }
+
+  /**
+   * Relabels vertices, such that vertex q becomes vertex indices[q], as Graph::shuffle does
+   *
+   * Rows are kept in their own order, so only vertex positions change, and only they are moved into owned
+   * storage if the database is mapped. Moves stay valid since re-ordering a graph keeps the order of edges within each adjacency.
+   */
+  void shuffle(const std::vector<std::size_t>& indices);
+
+  bool is_mapped() const { return !mapping_.empty(); }
+
+private:
+  static constexpr std::uint32_t kMoveMask = 0xFF;
+
+  MappedFile mapping_;
+
+  std::uint64_t edge_count_ = 0;
+  std::uint64_t graph_hash_ = 0;
+
+  std::span<const vertex_id_t> positions_;
+  std::span<const std::uint64_t> row_offsets_;
+  std::span<const std::uint32_t> runs_;
+
+  std::vector<vertex_id_t> owned_positions_;
+  std::vector<std::uint64_t> owned_row_offsets_;
+  std::vector<std::uint32_t> owned_runs_;
+};
+
+}  // namespace cppcon::demo::v3_cpd
@@ -0,0 +1,68 @@
+// C++ Standard Library
+#include <iostream>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+// CppCon
+#include <cppcon/demo/parallel.h>
+#include <cppcon/demo/v3_cpd/graph.h>
+
+namespace cppcon::demo::v3_cpd
+{
+namespace
+{
+
+/**
+ * Maps the database at \c database_file_name if it is usable for \c graph, or builds and saves a new one
+ */
+PathDatabase load_or_build(const v3_csr::Graph& graph, const std::filesystem::path& graph_file_name, const std::filesystem::path& database_file_name)
+{
+  std::error_code ec;
+  if (const auto database_time = std::filesystem::last_write_time(database_file_name, ec);
+      !ec and database_time >= std::filesystem::last_write_time(graph_file_name))
+  {
+    try
+    {
+      PathDatabase database{database_file_name};
+      if (database.is_built_for(graph.view()))
+      {
+        return database;
+      }
+      std::cerr << "Rebuilding path database: built for a different graph" << std::endl;
+    }
+    catch (const std::runtime_error& ex)
+    {
+      std::cerr << "Rebuilding path database: " << ex.what() << std::endl;
+    }
+  }
+
+  PathDatabase database{graph.view(), default_thread_count()};
+  try
+  {
+    database.save(database_file_name);
+  }
+  catch (const std::runtime_error& ex)
+  {
+    // Keep the database in memory; it is only rebuilt on the next load
+    std::cerr << "Path database not saved: " << ex.what() << std::endl;
+  }
+  return database;
+}
+
+}  // namespace
+
+static_assert(SearchGraph<Graph>);
+
+Graph::Graph(const std::filesystem::path& graph_file_name) :
+  graph_{graph_file_name},
+  database_{load_or_build(graph_, graph_file_name, std::filesystem::path{graph_file_name} += ".cpd")}
+{}
+
+void Graph::shuffle(const std::vector<std::size_t>& indices)
+{
+  graph_.shuffle(indices);
+  database_.shuffle(indices);
+}
+
+}  // namespace cppcon::demo::v3_cpd
@@ -0,0 +1,260 @@
+// C++ Standard Library
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+// CppCon
+#include <cppcon/landmarks.h>
+#include <cppcon/demo/parallel.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3_cpd/path_database.h>
+
+namespace cppcon::demo::v3_cpd
+{
+namespace
+{
+
+constexpr std::uint32_t kByteOrderTag = 0x01020304;
+
+constexpr std::uint64_t align_up(std::uint64_t n)
+{
+  return (n + kGraphFileAlignment - 1) / kGraphFileAlignment * kGraphFileAlignment;
+}
+
+template<typename T>
+std::span<const T> get_section(const MappedFile& file, const GraphFileSection& section, std::size_t count)
+{
+  // Counts and offsets come from the file, so every product and sum is checked for overflow
+  std::uint64_t size;
+  std::uint64_t end;
+  if (__builtin_mul_overflow(count, sizeof(T), &size) or
+      __builtin_add_overflow(section.offset, section.size, &end) or
+      section.size != size or section.offset % alignof(T) != 0 or end > file.size())
+  {
+    throw std::runtime_error{"path database section is out of bounds or misaligned"};
+  }
+  return {reinterpret_cast<const T*>(file.data() + section.offset), count};
+}
+
+}  // namespace
+
+std::uint64_t PathDatabase::graph_hash(const v3_csr::GraphView& graph)
+{
+  // FNV-1a over 32-bit words
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  const auto mix = [&hash](std::uint32_t word)
+  {
+    hash ^= word;
+    hash *= 0x100000001b3ULL;
+  };
+  for (const auto offset : graph.offsets())
+  {
+    mix(offset);
+  }
+  for (const auto& [succ, edge] : graph.edges())
+  {
+    mix(succ);
+    mix(edge.valid);
+    mix(edge.weight);
+  }
+  return hash;
+}
+
+PathDatabase::PathDatabase(const v3_csr::GraphView& graph, std::size_t thread_count) :
+  edge_count_{graph.edge_count()},
+  graph_hash_{graph_hash(graph)}
+{
+  const std::size_t n = graph.vertex_count();
+  if (n > kMaxVertexCount)
+  {
+    throw std::invalid_argument{"graph has too many vertices for a path database: " + std::to_string(n)};
+  }
+  for (vertex_id_t q = 0; q < n; ++q)
+  {
+    if (graph.offsets()[q + 1] - graph.offsets()[q] >= kNoMove)
+    {
+      throw std::invalid_argument{"vertex has too many edges for a path database: " + std::to_string(q)};
+    }
+  }
+
+  const auto permutation = make_permutation(graph, Ordering::kHilbert);
+  owned_positions_.assign(permutation.indices().begin(), permutation.indices().end());
+
+  std::vector<vertex_id_t> at_position(n);
+  for (vertex_id_t q = 0; q < n; ++q)
+  {
+    at_position[owned_positions_[q]] = q;
+  }
+
+  std::vector<std::vector<std::uint32_t>> rows(n);
+  parallel_for_ranges(
+    n,
+    thread_count,
+    [&](std::size_t first, std::size_t last, [[maybe_unused]] std::size_t range_index)
+    {
+      DistanceTree tree;
+      std::vector<std::uint8_t> move(n);
+      for (std::size_t p = first; p < last; ++p)
+      {
+        const vertex_id_t s = at_position[p];
+        search(tree, graph, s);
+
+        // Children of the source take the index of an edge which reaches them at their shortest distance;
+        // every other vertex inherits the move of its predecessor, which is settled before it
+        std::fill(move.begin(), move.end(), kNoMove);
+        std::uint8_t index = 0;
+        graph.for_each_edge(
+          s,
+          [&tree, &move, &index, s](vertex_id_t v, const EdgeProperties& edge)
+          {
+            if (edge.valid and v != s and move[v] == kNoMove and tree.predecessor(v) == s and tree.distance(v) == edge.weight)
+            {
+              move[v] = index;
+            }
+            ++index;
+          });
+        for (const vertex_id_t q : tree.settled())
+        {
+          if (tree.predecessor(q) != s)
+          {
+            move[q] = move[tree.predecessor(q)];
+          }
+        }
+
+        // Compress along target positions; the source itself may take any move, so it never starts a run
+        auto& row = rows[p];
+        for (vertex_id_t t_position = 0; t_position < n; ++t_position)
+        {
+          const vertex_id_t t = at_position[t_position];
+          if (t != s and (row.empty() or (row.back() & kMoveMask) != move[t]))
+          {
+            row.push_back((t_position << 8) | move[t]);
+          }
+        }
+        row.shrink_to_fit();
+      }
+    });
+
+  owned_row_offsets_.assign(n + 1, 0);
+  for (std::size_t p = 0; p < n; ++p)
+  {
+    owned_row_offsets_[p + 1] = owned_row_offsets_[p] + rows[p].size();
+  }
+  owned_runs_.reserve(owned_row_offsets_.back());
+  for (auto& row : rows)
+  {
+    owned_runs_.insert(owned_runs_.end(), row.begin(), row.end());
+    row = {};
+  }
+
+  positions_ = owned_positions_;
+  row_offsets_ = owned_row_offsets_;
+  runs_ = owned_runs_;
+}
+
+PathDatabase::PathDatabase(const std::filesystem::path& path) :
+  mapping_{path}
+{
+  PathDatabaseHeader header;
+  if (mapping_.size() < sizeof(header))
+  {
+    throw std::runtime_error{"path database is too small to hold a header"};
+  }
+  std::memcpy(&header, mapping_.data(), sizeof(header));
+
+  if (std::memcmp(header.magic, kPathDatabaseFileMagic, sizeof(kPathDatabaseFileMagic)) != 0)
+  {
+    throw std::runtime_error{"not a path database"};
+  }
+  if (header.version != kPathDatabaseFileVersion)
+  {
+    throw std::runtime_error{"unsupported path database version: " + std::to_string(header.version)};
+  }
+  if (header.byte_order_tag != kByteOrderTag)
+  {
+    throw std::runtime_error{"path database was written with an incompatible byte order"};
+  }
+  edge_count_ = header.edge_count;
+  graph_hash_ = header.graph_hash;
+
+  positions_ = get_section<vertex_id_t>(mapping_, header.positions, header.vertex_count);
+  row_offsets_ = get_section<std::uint64_t>(mapping_, header.row_offsets, header.vertex_count + 1);
+  runs_ = get_section<std::uint32_t>(mapping_, header.runs, header.run_count);
+
+  if (row_offsets_.front() != 0 or row_offsets_.back() != runs_.size() or !std::is_sorted(row_offsets_.begin(), row_offsets_.end()))
+  {
+    throw std::runtime_error{"path database has malformed row offsets"};
+  }
+  if (std::any_of(positions_.begin(), positions_.end(), [n=positions_.size()](vertex_id_t p) { return p >= n; }))
+  {
+    throw std::runtime_error{"path database has positions out of range"};
+  }
+}
+
+void PathDatabase::save(const std::filesystem::path& path) const
+{
+  PathDatabaseHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kPathDatabaseFileMagic, sizeof(kPathDatabaseFileMagic));
+  header.version = kPathDatabaseFileVersion;
+  header.byte_order_tag = kByteOrderTag;
+  header.vertex_count = positions_.size();
+  header.run_count = runs_.size();
+  header.edge_count = edge_count_;
+  header.graph_hash = graph_hash_;
+  header.positions = {align_up(sizeof(header)), positions_.size_bytes()};
+  header.row_offsets = {align_up(header.positions.offset + header.positions.size), row_offsets_.size_bytes()};
+  header.runs = {align_up(header.row_offsets.offset + header.row_offsets.size), runs_.size_bytes()};
+
+  // Written beside the destination under a unique name, then renamed over it, so that a concurrent load
+  // never maps a partly written database and an interrupted save leaves any previous one in place
+  const auto temp_path = std::filesystem::path{path} += ".tmp" + std::to_string(std::random_device{}());
+
+  std::ofstream ofs{temp_path, std::ios::binary};
+  if (!ofs)
+  {
+    throw std::runtime_error{"failed to open for writing: " + temp_path.string()};
+  }
+
+  const auto write_at = [&ofs](std::uint64_t offset, const void* data, std::size_t size)
+  {
+    static constexpr char kPadding[kGraphFileAlignment] = {};
+    ofs.write(kPadding, offset - static_cast<std::uint64_t>(ofs.tellp()));
+    ofs.write(static_cast<const char*>(data), size);
+  };
+
+  write_at(0, &header, sizeof(header));
+  write_at(header.positions.offset, positions_.data(), positions_.size_bytes());
+  write_at(header.row_offsets.offset, row_offsets_.data(), row_offsets_.size_bytes());
+  write_at(header.runs.offset, runs_.data(), runs_.size_bytes());
+  ofs.close();
+
+  std::error_code ec;
+  if (!ofs)
+  {
+    std::filesystem::remove(temp_path, ec);
+    throw std::runtime_error{"failed to write: " + temp_path.string()};
+  }
+  if (std::filesystem::rename(temp_path, path, ec); ec)
+  {
+    std::filesystem::remove(temp_path, ec);
+    throw std::runtime_error{"failed to write: " + path.string()};
+  }
+}
+
+void PathDatabase::shuffle(const std::vector<std::size_t>& indices)
+{
+  std::vector<vertex_id_t> positions(positions_.size());
+  for (std::size_t q = 0; q < indices.size(); ++q)
+  {
+    positions[indices[q]] = positions_[q];
+  }
+  owned_positions_ = std::move(positions);
+  positions_ = owned_positions_;
+}
+
+}  // namespace cppcon::demo::v3_cpd
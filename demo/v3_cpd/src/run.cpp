@@ -0,0 +1,15 @@
+// CppCon
+#include <cppcon/demo/run_impl.ipp>
+#include <cppcon/demo/v3_cpd/run.h>
+#include <cppcon/demo/v3_cpd/graph.h>
+#include <cppcon/demo/v3_cpd/context.h>
+
+namespace cppcon::demo::v3_cpd
+{
+
+void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings)
+{
+  ::cppcon::demo::run<TerminateAtGoal, Graph>(graph_in_json, result_out_json, settings);
+}
+
+}  // namespace cppcon::demo::v3_cpd
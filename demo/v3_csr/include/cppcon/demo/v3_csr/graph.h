@@ -0,0 +1,139 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/csr.h>
+#include <cppcon/demo/graph_file.h>
+
+namespace cppcon::demo::v3_csr
+{
+
+/**
+ * Non-owning view of CSR graph arrays
+ *
+ * Adjacency is indexed by (vertex_count + 1) 32-bit edge offsets rather than pointers, so the arrays may live
+ * anywhere (owned vectors, a mapped graph file, shared memory) and be used in place.
+ */
+class GraphView
+{
+public:
+  GraphView(
+    std::span<const VertexProperties> vertices,
+    std::span<const edge_offset_t> offsets,
+    std::span<const Edge> edges) :
+    vertices_{vertices},
+    offsets_{offsets},
+    edges_{edges}
+  {}
+
+  explicit GraphView(const GraphFileView& file) :
+    GraphView{file.vertices(), file.offsets(), file.edges()}
+  {}
+
+  const VertexProperties& vertex(vertex_id_t q) const { return vertices_[q]; }
+
+  std::size_t vertex_count() const { return vertices_.size(); }
+
+  std::size_t edge_count() const { return edges_.size(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    std::for_each(
+      edges_.begin() + offsets_[q],
+      edges_.begin() + offsets_[q + 1],
+      [visitor](const auto& child_and_edge_weight) mutable
+      {
+        const auto& [succ, edge_weight] = child_and_edge_weight;
+        visitor(succ, edge_weight);
+      });
+  }
+
+  std::span<const VertexProperties> vertices() const { return vertices_; }
+
+  std::span<const edge_offset_t> offsets() const { return offsets_; }
+
+  std::span<const Edge> edges() const { return edges_; }
+
+private:
+  std::span<const VertexProperties> vertices_;
+  std::span<const edge_offset_t> offsets_;
+  std::span<const Edge> edges_;
+};
+
+/**
+ * CSR graph which owns its arrays
+ *
+ * Holds no pointers into its own storage, so it may be copied and moved freely. Edge properties may be
+ * changed in place; slots of each adjacency are also indexed in order of successor, so that the edges
+ * between two vertices are found by binary search without changing the order in which edges are visited.
+ */
+class Graph
+{
+public:
+  explicit Graph(const std::filesystem::path& graph_file_name);
+
+  explicit Graph(CSRData csr);
+
+  void shuffle(const std::vector<std::size_t>& indices);
+
+  /**
+   * Writes this graph as a binary graph file
+   */
+  void save(const std::filesystem::path& graph_file_name) const;
+
+  GraphView view() const { return GraphView{vertices_, offsets_, edges_}; }
+
+  const VertexProperties& vertex(vertex_id_t q) const { return vertices_[q]; }
+
+  std::size_t vertex_count() const { return vertices_.size(); }
+
+  std::size_t edge_count() const { return edges_.size(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    view().for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  void prefetch_adjacency(vertex_id_t q) const { __builtin_prefetch(offsets_.data() + q); }
+
+  void prefetch_edges(vertex_id_t q) const { __builtin_prefetch(edges_.data() + offsets_[q]); }
+
+  /**
+   * Returns the properties of the first edge from \c pred to \c succ, or nullptr if there is none, or if
+   * \c pred is not a vertex
+   */
+  const EdgeProperties* find_edge(vertex_id_t pred, vertex_id_t succ) const;
+
+  /**
+   * Gives every edge from pred to succ of each update its new properties, in place and without allocating
+   *
+   * \return the number of updates which matched no edge, counting those whose pred is not a vertex
+   */
+  std::size_t update_edges(std::span<const EdgeUpdate> updates);
+
+private:
+  /**
+   * Returns the range of sorted_slots_ which holds the slots of edges from \c pred to \c succ
+   */
+  std::pair<const edge_offset_t*, const edge_offset_t*> find_slots(vertex_id_t pred, vertex_id_t succ) const;
+
+  void index_edges(std::size_t thread_count);
+
+  std::vector<VertexProperties> vertices_;
+  std::vector<edge_offset_t> offsets_;
+  std::vector<Edge> edges_;
+
+  /// Slots of the edges of each adjacency, ordered by successor, then by slot
+  std::vector<edge_offset_t> sorted_slots_;
+};
+
+}  // namespace cppcon::demo::v3_csr
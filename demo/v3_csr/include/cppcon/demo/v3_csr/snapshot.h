@@ -0,0 +1,186 @@
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/epoch.h>
+#include <cppcon/demo/graph_file.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+namespace cppcon::demo::v3_csr
+{
+
+/**
+ * CSR graph whose edge properties may be updated while other threads are searching it
+ *
+ * Vertices and offsets never change, and are shared by every version of the graph. Edges are split into
+ * blocks of kBlockVertexCount adjacencies; publishing a batch of updates copies only the blocks it touches
+ * into a new version, which shares every other block with the version before it. Readers pin the current
+ * version without locking and keep searching it while newer versions are published. A version is freed
+ * once no reader can still be using it (see EpochDomain), and a block once no version which is still alive
+ * uses it. Reclamation only runs on the writer side, in publish() and collect(); versions replaced by the
+ * last publish() are freed by the next call to either, once their readers have unpinned them.
+ */
+class SnapshotGraph
+{
+  struct Version;
+
+public:
+  static constexpr std::size_t kBlockShift = 6;
+
+  static constexpr std::size_t kBlockVertexCount = std::size_t{1} << kBlockShift;
+
+  /**
+   * One version of the graph, as a SearchGraph
+   */
+  class Snapshot
+  {
+  public:
+    const VertexProperties& vertex(vertex_id_t q) const { return vertices_[q]; }
+
+    std::size_t vertex_count() const { return vertices_.size(); }
+
+    template<typename EdgeVisitorT>
+    void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+    {
+      const std::size_t block = q >> kBlockShift;
+      const std::size_t block_offset = offsets_[block << kBlockShift];
+      for (std::size_t i = offsets_[q] - block_offset; i < offsets_[q + 1] - block_offset; ++i)
+      {
+        visitor(blocks_[block][i].first, blocks_[block][i].second);
+      }
+    }
+
+    /**
+     * Returns the number of batches published before this version
+     */
+    std::size_t version() const { return version_; }
+
+  private:
+    friend class SnapshotGraph;
+
+    std::span<const VertexProperties> vertices_;
+    std::span<const edge_offset_t> offsets_;
+    const Edge* const* blocks_ = nullptr;
+    std::size_t version_ = 0;
+  };
+
+  /**
+   * Current version of the graph at the time it was pinned, which stays alive for as long as the pin does
+   */
+  class Pin
+  {
+  public:
+    const Snapshot& graph() const { return snapshot_; }
+
+  private:
+    friend class SnapshotGraph;
+
+    EpochDomain::Guard guard_;
+    Snapshot snapshot_;
+  };
+
+  /**
+   * Handle through which one thread pins versions
+   */
+  class Reader
+  {
+  public:
+    /**
+     * Pins the current version; never waits on writers or other readers
+     */
+    Pin pin() const;
+
+  private:
+    friend class SnapshotGraph;
+
+    const SnapshotGraph* graph_ = nullptr;
+    EpochDomain::Reader reader_;
+  };
+
+  /**
+   * \param max_reader_count  number of Readers which may exist at once
+   */
+  SnapshotGraph(const Graph& graph, std::size_t max_reader_count);
+
+  SnapshotGraph(const SnapshotGraph&) = delete;
+
+  SnapshotGraph& operator=(const SnapshotGraph&) = delete;
+
+  ~SnapshotGraph();
+
+  /**
+   * Claims one of max_reader_count reader slots, for use by a single thread
+   */
+  Reader make_reader();
+
+  /**
+   * Publishes a new version in which every edge from pred to succ of each update takes its new properties
+   *
+   * Writers are serialized; readers are not blocked.
+   *
+   * \return the number of updates which matched no edge, counting those whose pred is not a vertex
+   */
+  std::size_t publish(std::span<const EdgeUpdate> updates);
+
+  /**
+   * Frees replaced versions which no reader can still be using, as publish() does
+   *
+   * Serialized with writers; readers are not blocked. Call once updates stop to free what the last
+   * publish() could not.
+   *
+   * \return the number of versions freed
+   */
+  std::size_t collect();
+
+  /**
+   * Returns the number of versions which have been replaced but may still be pinned by a reader
+   */
+  std::size_t retired_version_count() const;
+
+  /**
+   * Returns the number of edge blocks of one version
+   */
+  std::size_t block_count() const { return block_first_edge_.size() - 1; }
+
+  /**
+   * Returns the number of edge blocks held by all versions which are still alive
+   */
+  std::size_t live_block_count() const { return live_block_count_->load(std::memory_order_relaxed); }
+
+private:
+  using Block = std::vector<Edge>;
+
+  struct Version
+  {
+    std::size_t version;
+    std::vector<std::shared_ptr<Block>> blocks;
+    std::vector<const Edge*> block_edges;
+  };
+
+  std::shared_ptr<Block> make_block(Block edges) const;
+
+  std::vector<VertexProperties> vertices_;
+  std::vector<edge_offset_t> offsets_;
+
+  /// Offset of the first edge of each block, and the edge count
+  std::vector<edge_offset_t> block_first_edge_;
+
+  /// Shared with the deleter of every block
+  std::shared_ptr<std::atomic<std::size_t>> live_block_count_;
+
+  EpochDomain domain_;
+
+  mutable std::mutex writer_mutex_;
+
+  std::atomic<const Version*> current_;
+};
+
+}  // namespace cppcon::demo::v3_csr
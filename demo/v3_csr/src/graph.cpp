@@ -0,0 +1,130 @@
+// C++ Standard Library
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+// CppCon
+#include <cppcon/demo/v3_csr/graph.h>
+#include <cppcon/demo/permute.h>
+
+namespace cppcon::demo::v3_csr
+{
+
+static_assert(SearchGraph<Graph>);
+static_assert(SearchGraph<GraphView>);
+static_assert(std::is_nothrow_move_constructible_v<Graph> and std::is_copy_constructible_v<Graph>);
+
+Graph::Graph(const std::filesystem::path& graph_file_name) :
+  Graph{load_csr(graph_file_name)}
+{}
+
+Graph::Graph(CSRData csr) :
+  vertices_{std::move(csr.vertices)},
+  offsets_{std::move(csr.offsets)},
+  edges_{std::move(csr.edges)}
+{
+  if (offsets_.size() != vertices_.size() + 1 or offsets_.back() != edges_.size())
+  {
+    throw std::invalid_argument{"edge offsets do not match vertex and edge counts"};
+  }
+  index_edges(default_thread_count());
+}
+
+void Graph::shuffle(const std::vector<std::size_t>& indices)
+{
+  const std::size_t thread_count = default_thread_count();
+
+  this->vertices_ = permute_vertices(this->vertices_, indices, thread_count);
+
+  auto new_offsets = permute_offsets(
+    indices,
+    [this](vertex_id_t pred) { return this->offsets_[pred + 1] - this->offsets_[pred]; },
+    thread_count);
+
+  this->edges_ = permute_edges(
+    indices,
+    new_offsets,
+    [this, &indices](vertex_id_t pred, auto out)
+    {
+      std::transform(
+        this->edges_.begin() + this->offsets_[pred],
+        this->edges_.begin() + this->offsets_[pred + 1],
+        out,
+        [&indices](const Edge& edge) -> Edge
+        {
+          return {static_cast<vertex_id_t>(indices[edge.first]), edge.second};
+        });
+    },
+    Edge{0, EdgeProperties{0}},
+    thread_count);
+
+  this->offsets_.swap(new_offsets);
+
+  index_edges(thread_count);
+}
+
+void Graph::save(const std::filesystem::path& graph_file_name) const
+{
+  write_graph_file(graph_file_name, this->vertices_, this->offsets_, this->edges_);
+}
+
+const EdgeProperties* Graph::find_edge(vertex_id_t pred, vertex_id_t succ) const
+{
+  const auto [first, last] = find_slots(pred, succ);
+  return (first == last) ? nullptr : &edges_[*first].second;
+}
+
+std::size_t Graph::update_edges(std::span<const EdgeUpdate> updates)
+{
+  std::size_t unmatched = 0;
+  for (const auto& update : updates)
+  {
+    const auto [first, last] = find_slots(update.pred, update.succ);
+    std::for_each(first, last, [this, &update](edge_offset_t slot) { this->edges_[slot].second = update.edge; });
+    unmatched += (first == last);
+  }
+  return unmatched;
+}
+
+std::pair<const edge_offset_t*, const edge_offset_t*> Graph::find_slots(vertex_id_t pred, vertex_id_t succ) const
+{
+  // Ids come from outside (e.g. update feeds), so one which is not a vertex simply has no edges
+  if (pred >= vertices_.size())
+  {
+    return {nullptr, nullptr};
+  }
+  const edge_offset_t* const first = sorted_slots_.data() + offsets_[pred];
+  const edge_offset_t* const last = sorted_slots_.data() + offsets_[pred + 1];
+  const edge_offset_t* const lower = std::lower_bound(
+    first,
+    last,
+    succ,
+    [this](edge_offset_t slot, vertex_id_t v) { return this->edges_[slot].first < v; });
+  const edge_offset_t* upper = lower;
+  while (upper != last and edges_[*upper].first == succ)
+  {
+    ++upper;
+  }
+  return {lower, upper};
+}
+
+void Graph::index_edges(std::size_t thread_count)
+{
+  sorted_slots_.resize(edges_.size());
+  parallel_for_ranges(
+    vertices_.size(),
+    thread_count,
+    [this](std::size_t first, std::size_t last, [[maybe_unused]] std::size_t range_index)
+    {
+      for (std::size_t q = first; q < last; ++q)
+      {
+        const auto begin = this->sorted_slots_.begin() + this->offsets_[q];
+        const auto end = this->sorted_slots_.begin() + this->offsets_[q + 1];
+        std::iota(begin, end, this->offsets_[q]);
+        std::stable_sort(begin, end, [this](edge_offset_t lhs, edge_offset_t rhs) { return this->edges_[lhs].first < this->edges_[rhs].first; });
+      }
+    });
+}
+
+}  // namespace cppcon::demo::v3_csr
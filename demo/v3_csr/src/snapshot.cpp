@@ -0,0 +1,129 @@
+// C++ Standard Library
+#include <algorithm>
+
+// CppCon
+#include <cppcon/demo/v3_csr/snapshot.h>
+
+namespace cppcon::demo::v3_csr
+{
+
+static_assert(SearchGraph<SnapshotGraph::Snapshot>);
+
+SnapshotGraph::Pin SnapshotGraph::Reader::pin() const
+{
+  Pin pin;
+  pin.guard_ = reader_.enter();
+
+  const Version* const version = graph_->current_.load();
+  pin.snapshot_.vertices_ = graph_->vertices_;
+  pin.snapshot_.offsets_ = graph_->offsets_;
+  pin.snapshot_.blocks_ = version->block_edges.data();
+  pin.snapshot_.version_ = version->version;
+  return pin;
+}
+
+SnapshotGraph::SnapshotGraph(const Graph& graph, std::size_t max_reader_count) :
+  vertices_{graph.view().vertices().begin(), graph.view().vertices().end()},
+  offsets_{graph.view().offsets().begin(), graph.view().offsets().end()},
+  live_block_count_{std::make_shared<std::atomic<std::size_t>>(0)},
+  domain_{max_reader_count}
+{
+  const auto edges = graph.view().edges();
+  auto version = std::make_unique<Version>();
+  version->version = 0;
+  for (std::size_t first = 0; first < vertices_.size(); first += kBlockVertexCount)
+  {
+    const std::size_t last = std::min(vertices_.size(), first + kBlockVertexCount);
+    block_first_edge_.push_back(offsets_[first]);
+    version->blocks.push_back(make_block(Block{edges.begin() + offsets_[first], edges.begin() + offsets_[last]}));
+    version->block_edges.push_back(version->blocks.back()->data());
+  }
+  block_first_edge_.push_back(offsets_.back());
+  current_.store(version.release());
+}
+
+SnapshotGraph::~SnapshotGraph()
+{
+  delete current_.load();
+}
+
+SnapshotGraph::Reader SnapshotGraph::make_reader()
+{
+  Reader reader;
+  reader.graph_ = this;
+  reader.reader_ = domain_.register_reader();
+  return reader;
+}
+
+std::size_t SnapshotGraph::publish(std::span<const EdgeUpdate> updates)
+{
+  const std::scoped_lock lock{writer_mutex_};
+
+  const Version* const current = current_.load(std::memory_order_relaxed);
+  auto next = std::make_unique<Version>(*current);
+  next->version = current->version + 1;
+
+  std::size_t unmatched = 0;
+  for (const auto& update : updates)
+  {
+    if (update.pred >= vertices_.size())
+    {
+      ++unmatched;
+      continue;
+    }
+
+    // Copy each block on its first update in this batch
+    const std::size_t block = update.pred >> kBlockShift;
+    if (next->blocks[block] == current->blocks[block])
+    {
+      next->blocks[block] = make_block(*current->blocks[block]);
+      next->block_edges[block] = next->blocks[block]->data();
+    }
+
+    auto& edges = *next->blocks[block];
+    const std::size_t first = offsets_[update.pred] - block_first_edge_[block];
+    const std::size_t last = offsets_[update.pred + 1] - block_first_edge_[block];
+    bool matched = false;
+    for (std::size_t i = first; i < last; ++i)
+    {
+      if (edges[i].first == update.succ)
+      {
+        edges[i].second = update.edge;
+        matched = true;
+      }
+    }
+    unmatched += !matched;
+  }
+
+  // Readers which pinned the replaced version keep it until they leave; blocks go with the last version using them
+  current_.store(next.release());
+  domain_.retire([current] { delete current; });
+  domain_.collect();
+  return unmatched;
+}
+
+std::size_t SnapshotGraph::collect()
+{
+  const std::scoped_lock lock{writer_mutex_};
+  return domain_.collect();
+}
+
+std::size_t SnapshotGraph::retired_version_count() const
+{
+  const std::scoped_lock lock{writer_mutex_};
+  return domain_.retired_count();
+}
+
+std::shared_ptr<SnapshotGraph::Block> SnapshotGraph::make_block(Block edges) const
+{
+  live_block_count_->fetch_add(1, std::memory_order_relaxed);
+  return std::shared_ptr<Block>{
+    new Block{std::move(edges)},
+    [live_block_count=live_block_count_](Block* block)
+    {
+      live_block_count->fetch_sub(1, std::memory_order_relaxed);
+      delete block;
+    }};
+}
+
+}  // namespace cppcon::demo::v3_csr
@@ -0,0 +1,72 @@
+#pragma once
+
+// C++ Standard Library
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/graph_file.h>
+#include <cppcon/demo/reorder.h>
+#include <cppcon/demo/v3_csr/graph.h>
+
+namespace cppcon::demo::v3_mmap
+{
+
+/**
+ * CSR graph which is used directly from a mapped binary graph file
+ *
+ * Graph JSON files are also accepted, in which case the CSR arrays are built in memory. Re-ordering a
+ * mapped graph moves it into owned storage, since the mapping itself is read-only; a graph file written in
+ * the wanted ordering by convert_graph needs no re-ordering, and so stays mapped.
+ */
+class Graph
+{
+public:
+  explicit Graph(const std::filesystem::path& graph_file_name);
+
+  void shuffle(const std::vector<std::size_t>& indices);
+
+  /**
+   * Returns a view of the mapped or owned arrays, whichever are in use
+   */
+  const v3_csr::GraphView& view() const { return view_; }
+
+  const VertexProperties& vertex(vertex_id_t q) const { return view_.vertex(q); }
+
+  std::size_t vertex_count() const { return view_.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    view_.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  bool is_mapped() const { return !mapping_.empty(); }
+
+  /**
+   * Returns the ordering in which the graph file stores vertices, until the graph is shuffled
+   */
+  Ordering stored_ordering() const { return stored_ordering_; }
+
+  /**
+   * Returns the input ID of every vertex if they are stored re-ordered, until the graph is shuffled
+   */
+  std::span<const vertex_id_t> input_ids() const { return input_ids_; }
+
+private:
+  MappedFile mapping_;
+
+  v3_csr::GraphView view_{{}, {}, {}};
+
+  Ordering stored_ordering_ = Ordering::kIdentity;
+  std::span<const vertex_id_t> input_ids_;
+
+  std::vector<VertexProperties> owned_vertices_;
+  std::vector<edge_offset_t> owned_offsets_;
+  std::vector<Edge> owned_edges_;
+};
+
+}  // namespace cppcon::demo::v3_mmap
@@ -0,0 +1,41 @@
+// CppCon
+#include <cppcon/demo/v3_mmap/graph.h>
+#include <cppcon/demo/csr.h>
+
+namespace cppcon::demo::v3_mmap
+{
+
+Graph::Graph(const std::filesystem::path& graph_file_name)
+{
+  if (is_graph_file(graph_file_name))
+  {
+    this->mapping_ = MappedFile{graph_file_name};
+    const GraphFileView file{this->mapping_};
+    this->view_ = v3_csr::GraphView{file};
+    this->stored_ordering_ = file.ordering();
+    this->input_ids_ = file.input_ids();
+  }
+  else
+  {
+    auto csr = load_csr_from_json(graph_file_name);
+    this->owned_vertices_.swap(csr.vertices);
+    this->owned_offsets_.swap(csr.offsets);
+    this->owned_edges_.swap(csr.edges);
+    this->view_ = v3_csr::GraphView{this->owned_vertices_, this->owned_offsets_, this->owned_edges_};
+  }
+}
+
+void Graph::shuffle(const std::vector<std::size_t>& indices)
+{
+  auto csr = permute_csr(this->view_.vertices(), this->view_.offsets(), this->view_.edges(), indices);
+
+  this->owned_vertices_.swap(csr.vertices);
+  this->owned_offsets_.swap(csr.offsets);
+  this->owned_edges_.swap(csr.edges);
+  this->view_ = v3_csr::GraphView{this->owned_vertices_, this->owned_offsets_, this->owned_edges_};
+  this->stored_ordering_ = Ordering::kIdentity;
+  this->input_ids_ = {};
+  this->mapping_ = MappedFile{};
+}
+
+}  // namespace cppcon::demo::v3_mmap
@@ -0,0 +1,55 @@
+#pragma once
+
+// C++ Standard Library
+#include <filesystem>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/demo/graph_file.h>
+
+namespace cppcon::demo::v3_soa
+{
+
+/**
+ * CSR graph with edges stored as separate successor and weight arrays
+ *
+ * Edge validity is kept in the (reserved) high bit of each successor ID, so every edge costs 8 bytes rather
+ * than the 12 bytes of a padded Edge, and the edge hot loop touches only densely packed data.
+ */
+class Graph
+{
+public:
+  static constexpr vertex_id_t kInvalidEdgeBit = vertex_id_t{1} << 31;
+
+  explicit Graph(const std::filesystem::path& graph_file_name);
+
+  void shuffle(const std::vector<std::size_t>& indices);
+
+  const VertexProperties& vertex(vertex_id_t q) const { return vertices_[q]; }
+
+  std::size_t vertex_count() const { return vertices_.size(); }
+
+  std::size_t edge_count() const { return successors_.size(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    const vertex_id_t* const successors = successors_.data();
+    const edge_weight_t* const weights = weights_.data();
+    for (edge_offset_t i = offsets_[q]; i < offsets_[q + 1]; ++i)
+    {
+      EdgeProperties edge{weights[i]};
+      edge.valid = !(successors[i] & kInvalidEdgeBit);
+      visitor(successors[i] & ~kInvalidEdgeBit, edge);
+    }
+  }
+
+private:
+  std::vector<VertexProperties> vertices_;
+  std::vector<edge_offset_t> offsets_;
+  std::vector<vertex_id_t> successors_;
+  std::vector<edge_weight_t> weights_;
+};
+
+}  // namespace cppcon::demo::v3_soa
@@ -0,0 +1,79 @@
+// C++ Standard Library
+#include <algorithm>
+#include <stdexcept>
+
+// CppCon
+#include <cppcon/demo/v3_soa/graph.h>
+#include <cppcon/demo/csr.h>
+#include <cppcon/demo/permute.h>
+
+namespace cppcon::demo::v3_soa
+{
+
+Graph::Graph(const std::filesystem::path& graph_file_name)
+{
+  auto csr = load_csr(graph_file_name);
+  if (csr.vertices.size() > kInvalidEdgeBit)
+  {
+    throw std::runtime_error{"graph has too many vertices to reserve an edge validity bit"};
+  }
+
+  this->vertices_.swap(csr.vertices);
+  this->offsets_.swap(csr.offsets);
+
+  this->successors_.reserve(csr.edges.size());
+  this->weights_.reserve(csr.edges.size());
+  for (const auto& [succ, edge] : csr.edges)
+  {
+    this->successors_.push_back(edge.valid ? succ : (succ | kInvalidEdgeBit));
+    this->weights_.push_back(edge.weight);
+  }
+}
+
+void Graph::shuffle(const std::vector<std::size_t>& indices)
+{
+  const std::size_t thread_count = default_thread_count();
+
+  this->vertices_ = permute_vertices(this->vertices_, indices, thread_count);
+
+  auto new_offsets = permute_offsets(
+    indices,
+    [this](vertex_id_t pred) { return this->offsets_[pred + 1] - this->offsets_[pred]; },
+    thread_count);
+
+  auto new_successors = permute_edges(
+    indices,
+    new_offsets,
+    [this, &indices](vertex_id_t pred, auto out)
+    {
+      std::transform(
+        this->successors_.begin() + this->offsets_[pred],
+        this->successors_.begin() + this->offsets_[pred + 1],
+        out,
+        [&indices](vertex_id_t succ) -> vertex_id_t
+        {
+          return indices[succ & ~kInvalidEdgeBit] | (succ & kInvalidEdgeBit);
+        });
+    },
+    vertex_id_t{0},
+    thread_count);
+
+  auto new_weights = permute_edges(
+    indices,
+    new_offsets,
+    [this](vertex_id_t pred, auto out)
+    {
+      std::copy(
+        this->weights_.begin() + this->offsets_[pred],
+        this->weights_.begin() + this->offsets_[pred + 1],
+        out);
+    },
+    edge_weight_t{0},
+    thread_count);
+
+  this->offsets_.swap(new_offsets);
+  this->successors_.swap(new_successors);
+  this->weights_.swap(new_weights);
+}
+
+}  // namespace cppcon::demo::v3_soa
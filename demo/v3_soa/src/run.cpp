@@ -0,0 +1,15 @@
+// CppCon
+#include <cppcon/demo/run_impl.ipp>
+#include <cppcon/demo/v3/context.h>
+#include <cppcon/demo/v3_soa/run.h>
+#include <cppcon/demo/v3_soa/graph.h>
+
+namespace cppcon::demo::v3_soa
+{
+
+void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings)
+{
+  ::cppcon::demo::run<v3::TerminateAtGoal, Graph>(graph_in_json, result_out_json, settings);
+}
+
+}  // namespace cppcon::demo::v3_soa
@@ -0,0 +1,75 @@
+#pragma once
+
+// C++ Standard Library
+#include <limits>
+
+// CppCon
+#include <cppcon/epoch_array.h>
+#include <cppcon/radix_heap.h>
+#include <cppcon/search.h>
+
+namespace cppcon::demo::v4
+{
+
+/**
+ * v3::TerminateAtGoal with the binary heap replaced by a monotone radix heap
+ *
+ * Edge weights are integral and at least 1, so the keys of successive de-queued transitions never decrease.
+ * Predecessors are kept in an EpochArray, so resetting between searches is O(1).
+ */
+class TerminateAtGoal
+{
+public:
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  template<SearchGraph G>
+  void reset(G&& graph, vertex_id_t s)
+  {
+    queue_.clear();
+
+    visited_.reset(graph.vertex_count(), kUnvisited);
+
+    enqueue(s, s, 0);
+  }
+
+  bool is_queue_not_empty() const { return !queue_.empty(); }
+
+  bool is_visited(vertex_id_t q) const { return visited_.is_set(q); }
+
+  bool is_terminal(vertex_id_t q) const { return goal_ == q; }
+
+  void mark_visited(vertex_id_t p, vertex_id_t s) { visited_.set(s, p); }
+
+  vertex_id_t predecessor(vertex_id_t q) const
+  {
+    return visited_.get(q);
+  }
+
+  Transition dequeue()
+  {
+    auto t = queue_.top();
+    queue_.pop();
+    return t;
+  }
+
+  void enqueue(vertex_id_t p, vertex_id_t s, edge_weight_t w)
+  {
+    queue_.push(Transition{
+      .pred = p,
+      .succ = s,
+      .weight = w
+    });
+  }
+
+private:
+  static constexpr vertex_id_t kUnvisited = std::numeric_limits<vertex_id_t>::max();
+
+  vertex_id_t goal_;
+
+  RadixHeap<Transition> queue_;
+
+  EpochArray<vertex_id_t> visited_;
+};
+
+
+}  // namespace cppcon::demo::v4
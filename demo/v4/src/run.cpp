@@ -0,0 +1,15 @@
+// CppCon
+#include <cppcon/demo/run_impl.ipp>
+#include <cppcon/demo/v3/graph.h>
+#include <cppcon/demo/v4/run.h>
+#include <cppcon/demo/v4/context.h>
+
+namespace cppcon::demo::v4
+{
+
+void run(const std::filesystem::path& graph_in_json, const std::filesystem::path& result_out_json, const Settings& settings)
+{
+  ::cppcon::demo::run<TerminateAtGoal, v3::Graph>(graph_in_json, result_out_json, settings);
+}
+
+}  // namespace cppcon::demo::v4
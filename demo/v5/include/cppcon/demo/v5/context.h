@@ -0,0 +1,122 @@
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+// CppCon
+#include <cppcon/epoch_array.h>
+#include <cppcon/indexed_heap.h>
+#include <cppcon/search.h>
+
+namespace cppcon::demo::v5
+{
+
+struct QueueStats
+{
+  std::size_t pushes = 0;
+  std::size_t decrease_keys = 0;
+  std::size_t pops = 0;
+  std::size_t peak_size = 0;
+};
+
+/**
+ * Terminates at goal, queuing each vertex at most once
+ *
+ * Uses an indexed d-ary heap with decrease-key in place of lazy deletion: a shorter path to a queued vertex
+ * updates its existing entry, so the queue never holds more than one entry per vertex. The heap position of
+ * each vertex is stored next to its predecessor, in an EpochArray so that resetting between searches is O(1).
+ */
+template<std::size_t Arity>
+class BasicTerminateAtGoal
+{
+public:
+  BasicTerminateAtGoal() : queue_{HeapPosition{&states_}} {}
+
+  BasicTerminateAtGoal(const BasicTerminateAtGoal&) = delete;
+
+  BasicTerminateAtGoal& operator=(const BasicTerminateAtGoal&) = delete;
+
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  template<SearchGraph G>
+  void reset(G&& graph, vertex_id_t s)
+  {
+    queue_.clear();
+
+    states_.reset(graph.vertex_count(), VertexState{
+      .predecessor = kUnvisited,
+      .heap_position = Queue::kNotQueued
+    });
+
+    enqueue(s, s, 0);
+  }
+
+  bool is_queue_not_empty() const { return !queue_.empty(); }
+
+  bool is_visited(vertex_id_t q) const { return states_.get(q).predecessor != kUnvisited; }
+
+  bool is_terminal(vertex_id_t q) const { return goal_ == q; }
+
+  void mark_visited(vertex_id_t p, vertex_id_t s) { states_.touch(s).predecessor = p; }
+
+  vertex_id_t predecessor(vertex_id_t q) const
+  {
+    return states_.get(q).predecessor;
+  }
+
+  Transition dequeue()
+  {
+    auto t = queue_.top();
+    queue_.pop();
+    ++stats_.pops;
+    return t;
+  }
+
+  void enqueue(vertex_id_t p, vertex_id_t s, edge_weight_t w)
+  {
+    const auto update = queue_.push_or_decrease(Transition{
+      .pred = p,
+      .succ = s,
+      .weight = w
+    });
+    stats_.pushes += (update == Queue::Update::kInserted);
+    stats_.decrease_keys += (update == Queue::Update::kDecreased);
+    stats_.peak_size = std::max(stats_.peak_size, queue_.size());
+  }
+
+  /**
+   * Returns queue operation counts accumulated over all searches
+   */
+  const QueueStats& stats() const { return stats_; }
+
+private:
+  static constexpr vertex_id_t kUnvisited = std::numeric_limits<vertex_id_t>::max();
+
+  struct VertexState
+  {
+    vertex_id_t predecessor;
+    std::uint32_t heap_position;
+  };
+
+  struct HeapPosition
+  {
+    EpochArray<VertexState>* states;
+    std::uint32_t& operator()(vertex_id_t q) const { return states->touch(q).heap_position; }
+  };
+
+  using Queue = IndexedDaryHeap<Arity, Transition, &Transition::weight, &Transition::succ, HeapPosition>;
+
+  vertex_id_t goal_;
+
+  EpochArray<VertexState> states_;
+
+  Queue queue_;
+
+  QueueStats stats_;
+};
+
+using TerminateAtGoal = BasicTerminateAtGoal<4>;
+
+}  // namespace cppcon::demo::v5
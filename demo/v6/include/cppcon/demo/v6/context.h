@@ -0,0 +1,180 @@
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <limits>
+#include <vector>
+
+// CppCon
+#include <cppcon/bidirectional_search.h>
+#include <cppcon/epoch_array.h>
+#include <cppcon/search.h>
+#include <cppcon/demo/v3/context.h>
+
+namespace cppcon::demo::v6
+{
+
+/**
+ * Potential for plain bidirectional Dijkstra
+ */
+struct ZeroPotential
+{
+  using key_type = edge_weight_t;
+
+  template<SearchGraph G>
+  void reset([[maybe_unused]] const G& graph, [[maybe_unused]] vertex_id_t s, [[maybe_unused]] vertex_id_t g) {}
+
+  constexpr key_type operator()([[maybe_unused]] vertex_id_t q) const { return 0; }
+};
+
+/**
+ * Bidirectional search context; searches backward over the transposed copy kept beside the graph
+ *
+ * The transposed copy is shared by every context searching the same graph (see BasicGraph), which keeps it
+ * current when the graph is re-ordered or its edges change.
+ *
+ * Tentative distances and predecessors are labeled when a vertex is queued, rather than when it is visited,
+ * so that the path through a meeting vertex can be read back before both sides have visited it.
+ *
+ * \tparam PotentialT  consistent potential whose value is added to forward keys and subtracted from backward keys
+ */
+template<SearchGraph G, typename PotentialT = ZeroPotential>
+  requires requires(const G& graph) { graph.reverse_graph(); }
+class BasicTerminateAtGoal
+{
+public:
+  using key_type = typename PotentialT::key_type;
+
+  struct Entry
+  {
+    vertex_id_t pred;
+    vertex_id_t succ;
+    key_type key;
+
+    friend constexpr bool operator>(const Entry& lhs, const Entry& rhs) { return lhs.key > rhs.key; }
+  };
+
+  void set_goal(vertex_id_t g) { goal_ = g; }
+
+  vertex_id_t goal() const { return goal_; }
+
+  void reset(const G& graph, vertex_id_t s)
+  {
+    graph_ = &graph;
+
+    potential_.reset(graph, s, goal_);
+
+    for (auto& side : sides_)
+    {
+      side.queue_back_buffer.clear();
+      side.queue.underlying().swap(side.queue_back_buffer);
+      side.labels.reset(graph.vertex_count(), Label{});
+    }
+
+    meeting_vertex_ = s;
+    meeting_length_ = kInfiniteDistance;
+    settled_count_ = 0;
+
+    enqueue(Direction::kForward, s, s, 0);
+    enqueue(Direction::kBackward, goal_, goal_, 0);
+  }
+
+  decltype(auto) reverse_graph() const { return graph_->reverse_graph(); }
+
+  bool is_queue_not_empty(Direction d) const { return !side(d).queue.empty(); }
+
+  std::size_t queue_size(Direction d) const { return side(d).queue.size(); }
+
+  key_type top_key(Direction d) const { return side(d).queue.top().key; }
+
+  Entry dequeue(Direction d)
+  {
+    auto& queue = side(d).queue;
+    auto e = queue.top();
+    queue.pop();
+    return e;
+  }
+
+  bool is_visited(Direction d, vertex_id_t q) const { return side(d).labels.get(q).visited; }
+
+  void mark_visited(Direction d, [[maybe_unused]] vertex_id_t p, vertex_id_t s)
+  {
+    side(d).labels.touch(s).visited = true;
+    ++settled_count_;
+  }
+
+  edge_weight_t distance(Direction d, vertex_id_t q) const { return side(d).labels.get(q).distance; }
+
+  /**
+   * Labels \c s with distance \c w through \c p, and queues it, if that is shorter than its current label
+   */
+  bool enqueue(Direction d, vertex_id_t p, vertex_id_t s, edge_weight_t w)
+  {
+    auto& label = side(d).labels.touch(s);
+    if (w >= label.distance)
+    {
+      return false;
+    }
+    label.distance = w;
+    label.predecessor = p;
+
+    const key_type potential = potential_(s);
+    side(d).queue.push(Entry{
+      .pred = p,
+      .succ = s,
+      .key = (d == Direction::kForward) ? (w + potential) : (w - potential)
+    });
+    return true;
+  }
+
+  vertex_id_t predecessor(Direction d, vertex_id_t q) const { return side(d).labels.get(q).predecessor; }
+
+  void meet(vertex_id_t q, edge_weight_t length)
+  {
+    meeting_vertex_ = q;
+    meeting_length_ = length;
+  }
+
+  vertex_id_t meeting_vertex() const { return meeting_vertex_; }
+
+  edge_weight_t meeting_length() const { return meeting_length_; }
+
+  /**
+   * Returns the number of vertices visited by both directions of the last search
+   */
+  std::size_t settled_count() const { return settled_count_; }
+
+private:
+  struct Label
+  {
+    edge_weight_t distance = kInfiniteDistance;
+    vertex_id_t predecessor = std::numeric_limits<vertex_id_t>::max();
+    bool visited = false;
+  };
+
+  struct Side
+  {
+    v3::MinQueue<Entry> queue;
+    std::vector<Entry> queue_back_buffer;
+    EpochArray<Label> labels;
+  };
+
+  Side& side(Direction d) { return sides_[static_cast<std::size_t>(d)]; }
+
+  const Side& side(Direction d) const { return sides_[static_cast<std::size_t>(d)]; }
+
+  const G* graph_ = nullptr;
+
+  PotentialT potential_;
+
+  vertex_id_t goal_;
+
+  std::array<Side, 2> sides_;
+
+  vertex_id_t meeting_vertex_;
+  edge_weight_t meeting_length_ = kInfiniteDistance;
+
+  std::size_t settled_count_ = 0;
+};
+
+}  // namespace cppcon::demo::v6
@@ -0,0 +1,72 @@
+#pragma once
+
+// C++ Standard Library
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+
+// CppCon
+#include <cppcon/search.h>
+#include <cppcon/transpose.h>
+#include <cppcon/demo/v3/graph.h>
+
+namespace cppcon::demo::v6
+{
+
+/**
+ * Graph with a transposed copy for backward searches, which is built beside it and shared by every context
+ *
+ * The transposed copy is rebuilt whenever the graph is re-ordered, and updated along with it whenever its
+ * edges change, so backward searches never see stale edges. Since the copy refers to the graph it was built
+ * from, neither may be moved.
+ */
+template<SearchGraph G>
+class BasicGraph
+{
+public:
+  explicit BasicGraph(const std::filesystem::path& json) :
+    graph_{json},
+    reverse_graph_{graph_}
+  {}
+
+  BasicGraph(const BasicGraph&) = delete;
+
+  BasicGraph& operator=(const BasicGraph&) = delete;
+
+  void shuffle(const std::vector<std::size_t>& indices)
+  {
+    graph_.shuffle(indices);
+    reverse_graph_ = TransposedGraph<G>{graph_};
+  }
+
+  /**
+   * Gives edges new properties in the graph and in its transposed copy, for graphs which can be updated
+   */
+  std::size_t update_edges(std::span<const EdgeUpdate> updates)
+    requires requires(G& graph) { graph.update_edges(updates); }
+  {
+    reverse_graph_.update_edges(updates);
+    return graph_.update_edges(updates);
+  }
+
+  decltype(auto) vertex(vertex_id_t q) const { return graph_.vertex(q); }
+
+  std::size_t vertex_count() const { return graph_.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph_.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  const TransposedGraph<G>& reverse_graph() const { return reverse_graph_; }
+
+private:
+  G graph_;
+  TransposedGraph<G> reverse_graph_;
+};
+
+using Graph = BasicGraph<v3::Graph>;
+
+}  // namespace cppcon::demo::v6
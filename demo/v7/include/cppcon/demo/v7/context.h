@@ -0,0 +1,11 @@
+#pragma once
+
+// CppCon
+#include <cppcon/contraction_hierarchy.h>
+
+namespace cppcon::demo::v7
+{
+
+using TerminateAtGoal = HierarchyQuery;
+
+}  // namespace cppcon::demo::v7
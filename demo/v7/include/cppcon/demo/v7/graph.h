@@ -0,0 +1,42 @@
+#pragma once
+
+// C++ Standard Library
+#include <filesystem>
+#include <vector>
+
+// CppCon
+#include <cppcon/contraction_hierarchy.h>
+#include <cppcon/search.h>
+#include <cppcon/demo/v3/graph.h>
+
+namespace cppcon::demo::v7
+{
+
+/**
+ * v3::Graph with a contraction hierarchy, which is built once when the graph is loaded
+ */
+class Graph
+{
+public:
+  explicit Graph(const std::filesystem::path& json);
+
+  void shuffle(const std::vector<std::size_t>& indices);
+
+  const VertexProperties& vertex(vertex_id_t q) const { return graph_.vertex(q); }
+
+  std::size_t vertex_count() const { return graph_.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph_.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  const ContractionHierarchy& hierarchy() const { return hierarchy_; }
+
+private:
+  v3::Graph graph_;
+  ContractionHierarchy hierarchy_;
+};
+
+}  // namespace cppcon::demo::v7
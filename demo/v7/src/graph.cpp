@@ -0,0 +1,18 @@
+// CppCon
+#include <cppcon/demo/v7/graph.h>
+
+namespace cppcon::demo::v7
+{
+
+Graph::Graph(const std::filesystem::path& json) :
+  graph_{json},
+  hierarchy_{graph_}
+{}
+
+void Graph::shuffle(const std::vector<std::size_t>& indices)
+{
+  graph_.shuffle(indices);
+  hierarchy_.shuffle(indices);
+}
+
+}  // namespace cppcon::demo::v7
@@ -0,0 +1,11 @@
+#pragma once
+
+// CppCon
+#include <cppcon/customizable_contraction_hierarchy.h>
+
+namespace cppcon::demo::v8
+{
+
+using TerminateAtGoal = CustomizableHierarchyQuery;
+
+}  // namespace cppcon::demo::v8
@@ -0,0 +1,63 @@
+#pragma once
+
+// C++ Standard Library
+#include <filesystem>
+#include <vector>
+
+// CppCon
+#include <cppcon/customizable_contraction_hierarchy.h>
+#include <cppcon/search.h>
+#include <cppcon/demo/v3/graph.h>
+
+namespace cppcon::demo::v8
+{
+
+/**
+ * v3::Graph with a customizable contraction hierarchy
+ *
+ * The hierarchy is ordered and contracted once when the graph is loaded; customize re-derives its weights
+ * after edge weights change, either from the loaded graph or from a graph of new weights.
+ */
+class Graph
+{
+public:
+  explicit Graph(const std::filesystem::path& json);
+
+  void shuffle(const std::vector<std::size_t>& indices);
+
+  /**
+   * Recomputes hierarchy weights from the current edge weights of the graph
+   */
+  void customize(std::size_t thread_count);
+
+  /**
+   * Recomputes hierarchy weights from the edge weights of \c weights, such as live traffic data
+   *
+   * \c weights must have the same vertices, in the same (shuffled) order, and the same edges as this graph;
+   * only edge weights and validity may differ. Searches and their paths follow these weights from then on,
+   * while for_each_edge still visits the loaded ones.
+   */
+  template<SearchGraph G>
+  void customize(const G& weights, std::size_t thread_count)
+  {
+    hierarchy_.customize(weights, thread_count);
+  }
+
+  const VertexProperties& vertex(vertex_id_t q) const { return graph_.vertex(q); }
+
+  std::size_t vertex_count() const { return graph_.vertex_count(); }
+
+  template<typename EdgeVisitorT>
+  void for_each_edge(vertex_id_t q, EdgeVisitorT&& visitor) const
+  {
+    graph_.for_each_edge(q, std::forward<EdgeVisitorT>(visitor));
+  }
+
+  const CustomizableContractionHierarchy& hierarchy() const { return hierarchy_; }
+
+private:
+  v3::Graph graph_;
+  CustomizableContractionHierarchy hierarchy_;
+};
+
+}  // namespace cppcon::demo::v8
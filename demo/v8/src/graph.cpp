@@ -0,0 +1,28 @@
+// C++ Standard Library
+#include <thread>
+
+// CppCon
+#include <cppcon/demo/v8/graph.h>
+
+namespace cppcon::demo::v8
+{
+
+Graph::Graph(const std::filesystem::path& json) :
+  graph_{json},
+  hierarchy_{graph_}
+{
+  customize(std::thread::hardware_concurrency());
+}
+
+void Graph::shuffle(const std::vector<std::size_t>& indices)
+{
+  graph_.shuffle(indices);
+  hierarchy_.shuffle(indices);
+}
+
+void Graph::customize(std::size_t thread_count)
+{
+  customize(graph_, thread_count);
+}
+
+}  // namespace cppcon::demo::v8
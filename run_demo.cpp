@@ -1,33 +1,16 @@
-#ifdef __linux__    // Linux only
-#include <sched.h>  // sched_setaffinity
-#endif
-
 // C++ Standard Library
+#include <exception>
 #include <iostream>
 #include <sstream>
+#include <string>
 
 // CPPCon
+#include <cppcon/demo/topology.h>
 #include "auto_generated_includes.h"
 #include "auto_generated_commands.h"
 
 using namespace cppcon;
 
-void cpu_pin(int cpu)
-{
-  #ifdef __linux__
-    cpu_set_t mask;
-    int status;
-
-    CPU_ZERO(&mask);
-    CPU_SET(cpu, &mask);
-    status = sched_setaffinity(0, sizeof(mask), &mask);
-    if (status != 0)
-    {
-      perror("sched_setaffinity");
-    }
-  #endif
-}
-
 template<typename T>
 T to(std::string_view str)
 {
@@ -41,21 +24,37 @@ T to(std::string_view str)
 
 int main(int argc, char** argv)
 {
-  if (argc < 3)
+  const auto ordering = (argc > 6) ? demo::to_ordering(argv[6]) : demo::Ordering::kHilbert;
+  const auto mode = (argc > 7) ? to<std::string>(argv[7]) : std::string{"search"};
+  if (argc < 3 or !ordering or (mode != "search" and mode != "tree"))
   {
-    std::cerr << argv[0] << " <graph_json> <output_json> [<percentage or problems>] [<shuffle_seed>]" << std::endl;
+    std::cerr << argv[0] << " <graph_json> <output_json> [<percentage or problems>] [<shuffle_seed>] [<run_search: yes|no>] [<ordering: identity|hilbert|rcm|bfs|dfs>] [<mode: search|tree>] [<threads: 0 for all CPUs>]" << std::endl;
     return 1;
   }
 
-  cpu_pin(1);
-
-  const demo::Settings settings{
+  demo::Settings settings{
     .percentage_of_problems = (argc > 3) ? (to<float>(argv[3]) / 100.f) : 0.1f,
     .shuffle_seed = (argc > 4) ? to<std::size_t>(argv[4]) : 0,
-    .run_search = (argc < 6) or (to<std::string>(argv[5]) == "yes")
+    .ordering = *ordering,
+    .run_search = (argc < 6) or (to<std::string>(argv[5]) == "yes"),
+    .plan_all_to_goal = (mode == "tree"),
+    .thread_count = (argc > 8) ? to<std::size_t>(argv[8]) : 1
   };
 
-  RUN_ALL_DEMOS(argv[1], argv[2], settings);
+  if (settings.thread_count == 0)
+  {
+    settings.thread_count = demo::worker_cpu_order().size();
+  }
+
+  try
+  {
+    RUN_ALL_DEMOS(argv[1], argv[2], settings);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << ex.what() << std::endl;
+    return 1;
+  }
 
   return 0;
 }
\ No newline at end of file